@@ -0,0 +1,304 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Offline render benchmark.
+ * @details Replays recorded /devices and /status fixtures through the sensor
+ * parser, the dual/circle renderers and the PNG encoder without a running
+ * coolercontrold, and reports ns/frame per stage, frame-loop allocations per
+ * frame and PNG size. Each fixture directory holds config.json, devices.json
+ * and status.json.
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../src/device/config.h"
+#include "../src/device/stats.h"
+#include "../src/mods/circle.h"
+#include "../src/mods/display.h"
+#include "../src/mods/dual.h"
+#include "../src/mods/encoder.h"
+#include "../src/mods/history.h"
+#include "../src/srv/cc_conf.h"
+#include "../src/srv/cc_main.h"
+#include "../src/srv/cc_sensor.h"
+
+// Defined by main.c in the daemon
+int verbose_logging = 0;
+
+#define BENCH_DEFAULT_FRAMES 200
+#define BENCH_PATH_LEN 512
+
+/** @brief Sensor value offsets cycled per frame, so values change like live data. */
+static const float value_steps[] = {0.0f, 0.5f, 1.0f, 1.5f, 1.0f, 0.5f};
+#define VALUE_STEP_COUNT (int)(sizeof(value_steps) / sizeof(value_steps[0]))
+
+// Encoder output, reused across frames and fixtures like the pipeline's
+static png_buffer_t png;
+
+/** @brief Accumulated results of one fixture. */
+typedef struct
+{
+    uint64_t parse_ns;
+    uint64_t render_ns;
+    uint64_t encode_ns;
+    uint64_t first_frame_ns;
+    unsigned long allocations;
+    size_t png_bytes;
+    int frames;
+} BenchResult;
+
+/**
+ * @brief Read a whole file into a NUL-terminated heap buffer.
+ * @return Buffer (caller frees), or NULL
+ */
+static char *read_file(const char *path, size_t *size)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return NULL;
+    }
+
+    char *data = NULL;
+    if (fseek(fp, 0, SEEK_END) == 0)
+    {
+        const long length = ftell(fp);
+        if (length > 0 && fseek(fp, 0, SEEK_SET) == 0)
+        {
+            data = malloc((size_t)length + 1);
+            if (data && fread(data, 1, (size_t)length, fp) == (size_t)length)
+            {
+                data[length] = '\0';
+                *size = (size_t)length;
+            }
+            else
+            {
+                free(data);
+                data = NULL;
+            }
+        }
+    }
+
+    fclose(fp);
+    if (!data)
+        fprintf(stderr, "Cannot read %s\n", path);
+    return data;
+}
+
+/** @brief Build "<dir>/<name>". */
+static int fixture_path(char *buf, size_t size, const char *dir,
+                        const char *name)
+{
+    const int written = snprintf(buf, size, "%s/%s", dir, name);
+    return written > 0 && (size_t)written < size;
+}
+
+/** @brief Shift every sensor value, as a new poll would. */
+static void step_sensor_values(monitor_sensor_data_t *data, int frame)
+{
+    const float step = value_steps[frame % VALUE_STEP_COUNT];
+    for (int i = 0; i < data->sensor_count; i++)
+        data->sensors[i].value += step;
+}
+
+/** @brief Render one frame of the configured mode. */
+static cairo_surface_t *render_frame(const Config *config,
+                                     const monitor_sensor_data_t *data)
+{
+    record_slot_history(config, data);
+    return strcmp(config->display_mode, "circle") == 0
+               ? render_circle_surface(config, data)
+               : render_dual_surface(config, data);
+}
+
+/**
+ * @brief Load a fixture's config and device cache.
+ */
+static int load_fixture(const char *dir, Config *config)
+{
+    char path[BENCH_PATH_LEN];
+
+    // load_plugin_config() falls back to the system config if the file is missing
+    if (!fixture_path(path, sizeof(path), dir, "config.json"))
+        return 0;
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 0;
+    }
+    fclose(fp);
+    load_plugin_config(config, path);
+
+    size_t size = 0;
+    if (!fixture_path(path, sizeof(path), dir, "devices.json"))
+        return 0;
+    char *devices = read_file(path, &size);
+    if (!devices)
+        return 0;
+
+    const int found = init_device_cache_from_json(config, devices, size);
+    free(devices);
+    if (!found)
+    {
+        fprintf(stderr, "%s: no LCD device in devices.json\n", dir);
+        return 0;
+    }
+
+    update_config_from_device(config);
+    build_layout_plan(config);
+    return 1;
+}
+
+/**
+ * @brief Run one fixture.
+ * @details The first frame after a state reset is timed on its own (cold
+ * caches, full redraw); the steady-state loop then replays the status with
+ * shifted values so dirty-region redraws and encoding get real work.
+ */
+static int run_fixture(const char *dir, int frames, BenchResult *result)
+{
+    static Config config;
+    static monitor_sensor_data_t data;
+
+    memset(result, 0, sizeof(*result));
+    reset_device_cache();
+    reset_sensor_state();
+    reset_display_state();
+
+    if (!load_fixture(dir, &config))
+        return 0;
+
+    char path[BENCH_PATH_LEN];
+    size_t status_size = 0;
+    if (!fixture_path(path, sizeof(path), dir, "status.json"))
+        return 0;
+    char *status = read_file(path, &status_size);
+    if (!status)
+        return 0;
+
+    int ok = parse_sensor_status(&config, 1, status, status_size, &data);
+    if (ok)
+    {
+        const uint64_t start = stats_clock_ns();
+        cairo_surface_t *surface = render_frame(&config, &data);
+        ok = surface && encode_png_frame(surface, config.display_png_compression,
+                                         &png);
+        result->first_frame_ns = stats_clock_ns() - start;
+    }
+
+    const unsigned long allocations_before = get_allocation_count();
+    for (int i = 0; ok && i < frames; i++)
+    {
+        uint64_t start = stats_clock_ns();
+        ok = parse_sensor_status(&config, 1, status, status_size, &data);
+        result->parse_ns += stats_clock_ns() - start;
+        if (!ok)
+            break;
+        step_sensor_values(&data, i);
+
+        start = stats_clock_ns();
+        cairo_surface_t *surface = render_frame(&config, &data);
+        result->render_ns += stats_clock_ns() - start;
+        if (!surface)
+        {
+            ok = 0;
+            break;
+        }
+
+        start = stats_clock_ns();
+        ok = encode_png_frame(surface, config.display_png_compression, &png);
+        result->encode_ns += stats_clock_ns() - start;
+        result->png_bytes += png.size;
+        result->frames++;
+    }
+    result->allocations = get_allocation_count() - allocations_before;
+
+    free(status);
+    if (!ok)
+        fprintf(stderr, "%s: frame failed after %d frames\n", dir,
+                result->frames);
+    else
+        printf("%-32s %4dx%-4d %-6s %3d sensors\n", dir, config.display_width,
+               config.display_height, config.display_mode, data.sensor_count);
+    return ok;
+}
+
+/** @brief Print one result row. */
+static void print_result(const char *dir, const BenchResult *result)
+{
+    const double frames = result->frames > 0 ? (double)result->frames : 1.0;
+    printf("%-32s %10.0f %10.0f %10.0f %10.0f %8.2f %8.0f\n", dir,
+           (double)result->first_frame_ns, (double)result->parse_ns / frames,
+           (double)result->render_ns / frames,
+           (double)result->encode_ns / frames,
+           (double)result->allocations / frames,
+           (double)result->png_bytes / frames);
+}
+
+/** @brief Show usage. */
+static void show_usage(const char *program)
+{
+    printf("Usage: %s [--frames N] FIXTURE_DIR...\n", program);
+    printf("Each FIXTURE_DIR holds config.json, devices.json and status.json.\n");
+}
+
+int main(int argc, char **argv)
+{
+    int frames = BENCH_DEFAULT_FRAMES;
+    int first_fixture = 1;
+
+    if (argc > 2 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = atoi(argv[2]);
+        first_fixture = 3;
+    }
+    if (frames <= 0 || first_fixture >= argc)
+    {
+        show_usage(argv[0]);
+        return 1;
+    }
+
+    const int fixture_count = argc - first_fixture;
+    BenchResult *results = calloc((size_t)fixture_count, sizeof(*results));
+    if (!results)
+        return 1;
+
+    int failed = 0;
+    for (int i = 0; i < fixture_count; i++)
+    {
+        if (!run_fixture(argv[first_fixture + i], frames, &results[i]))
+            failed = 1;
+    }
+
+    printf("\n%d frames per fixture, times in ns/frame\n", frames);
+    printf("%-32s %10s %10s %10s %10s %8s %8s\n", "fixture", "first", "parse",
+           "render", "encode", "allocs", "png");
+    for (int i = 0; i < fixture_count; i++)
+        print_result(argv[first_fixture + i], &results[i]);
+
+    free(results);
+    cleanup_png_encoder(&png);
+    release_frame_canvases();
+    reset_display_state();
+    return failed;
+}
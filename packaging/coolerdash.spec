@@ -16,8 +16,9 @@ BuildRequires:  pkgconfig
 BuildRequires:  pkgconfig(cairo)
 BuildRequires:  pkgconfig(jansson)
 BuildRequires:  pkgconfig(libcurl)
+BuildRequires:  pkgconfig(zlib)
 
-# Shared lib deps (libcairo, libjansson, libcurl) are auto-detected by rpmbuild
+# Shared lib deps (libcairo, libjansson, libcurl, zlib) are auto-detected by rpmbuild
 Requires:       google-roboto-fonts
 Recommends:     coolercontrol
 
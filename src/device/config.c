@@ -15,7 +15,7 @@
 #define _XOPEN_SOURCE 600
 
 // cppcheck-suppress-begin missingIncludeSystem
-#include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <jansson.h>
@@ -29,36 +29,6 @@
 #define LEGACY_LCD_IMAGE_PATH "/etc/coolercontrol/lcd_image.png"
 #define DEFAULT_LCD_IMAGE_PATH DEFAULT_COOLERDASH_PLUGIN_DIR "/coolerdash.png"
 
-// ============================================================================
-// Global Logging Implementation
-// ============================================================================
-
-/** @brief Global log_message implementation for all modules except main.c. */
-void log_message(log_level_t level, const char *format, ...)
-{
-    if (level == LOG_INFO && !verbose_logging)
-    {
-        return;
-    }
-    const char *prefix[] = {"INFO", "STATUS", "WARNING", "ERROR"};
-    FILE *output = (level == LOG_ERROR) ? stderr : stdout;
-    fprintf(output, "[CoolerDash %s] ", prefix[level]);
-
-    enum
-    {
-        LOG_MSG_CAP = 1024
-    };
-    char msg_buf[LOG_MSG_CAP];
-    msg_buf[0] = '\0';
-    va_list args;
-    va_start(args, format);
-    vsnprintf(msg_buf, sizeof(msg_buf), (format ? format : "(null)"), args);
-    va_end(args);
-    fputs(msg_buf, output);
-    fputc('\n', output);
-    fflush(output);
-}
-
 // ============================================================================
 // Default Values Implementation
 // ============================================================================
@@ -72,6 +42,10 @@ static void set_daemon_defaults(Config *config)
     {
         SAFE_STRCPY(config->daemon_address, "http://localhost:11987");
     }
+    if (config->daemon_sensor_source[0] == '\0')
+    {
+        SAFE_STRCPY(config->daemon_sensor_source, "poll");
+    }
 }
 
 /**
@@ -150,6 +124,21 @@ static void set_display_defaults(Config *config)
 
     if (config->display_refresh_interval == 0.0f)
         config->display_refresh_interval = 3.50f;
+    if (config->display_force_refresh_interval < 0)
+        config->display_force_refresh_interval = 60;
+    if (config->display_refresh_mode[0] == '\0')
+        cc_safe_strcpy(config->display_refresh_mode,
+                       sizeof(config->display_refresh_mode), "fixed");
+    if (config->display_refresh_interval_max == 0.0f)
+        config->display_refresh_interval_max = 10.0f;
+    if (config->display_refresh_interval_max < config->display_refresh_interval)
+        config->display_refresh_interval_max = config->display_refresh_interval;
+    if (config->display_adaptive_delta < 0.0f)
+        config->display_adaptive_delta = 0.5f;
+    if (config->display_adaptive_samples == 0)
+        config->display_adaptive_samples = 5;
+    if (config->display_png_compression < 0)
+        config->display_png_compression = 1;
     if (config->lcd_brightness == 0)
         config->lcd_brightness = 80;
     if (!is_valid_orientation(config->lcd_orientation))
@@ -159,10 +148,15 @@ static void set_display_defaults(Config *config)
     if (config->display_background_image_fit[0] == '\0')
         cc_safe_strcpy(config->display_background_image_fit,
                        sizeof(config->display_background_image_fit), "cover");
+    if (config->display_upload_mode[0] == '\0')
+        cc_safe_strcpy(config->display_upload_mode,
+                       sizeof(config->display_upload_mode), "auto");
     if (config->circle_switch_interval == 0)
         config->circle_switch_interval = 8;
     if (config->circle_show_extra_info < 0)
         config->circle_show_extra_info = 1; // enabled by default
+    if (config->circle_animation < 0)
+        config->circle_animation = 0;
     if (config->display_content_scale_factor == 0.0f)
         config->display_content_scale_factor = 0.98f;
     if (config->display_background_overlay_opacity < 0.0f ||
@@ -201,6 +195,10 @@ static void set_layout_defaults(Config *config)
     // bar_border_enabled: -1 = auto (enabled), 0 = disabled, 1 = enabled
     if (config->layout_bar_border_enabled < 0)
         config->layout_bar_border_enabled = 1; // Default: enabled
+    if (config->layout_sparkline_enabled < 0)
+        config->layout_sparkline_enabled = 0; // Default: disabled
+    if (config->layout_sparkline_samples == CONFIG_LAYOUT_U16_UNSET)
+        config->layout_sparkline_samples = 60;
 
     // Individual bar heights default to inherit-from-global when unspecified.
     if (config->layout_bar_height_1 == CONFIG_LAYOUT_U16_UNSET)
@@ -699,6 +697,16 @@ static void load_daemon_from_json(json_t *root, Config *config)
             SAFE_STRCPY(config->access_token, value);
         }
     }
+
+    json_t *sensor_source = json_object_get(daemon, "sensor_source");
+    if (sensor_source && json_is_string(sensor_source))
+    {
+        const char *value = json_string_value(sensor_source);
+        if (value && (strcmp(value, "poll") == 0 || strcmp(value, "sse") == 0))
+        {
+            SAFE_STRCPY(config->daemon_sensor_source, value);
+        }
+    }
 }
 
 /**
@@ -995,13 +1003,19 @@ static void load_paths_from_json(json_t *root, Config *config)
 }
 
 /**
- * @brief Load display settings from JSON.
+ * @brief Load display settings from a "display" or "displays" entry object.
  */
-static void load_display_from_json(json_t *root, Config *config)
+static void load_display_settings(json_t *display, Config *config)
 {
-    json_t *display = json_object_get(root, "display");
-    if (!display || !json_is_object(display))
-        return;
+    json_t *device = json_object_get(display, "device");
+    if (device && json_is_string(device))
+    {
+        const char *value = json_string_value(device);
+        if (value)
+        {
+            SAFE_STRCPY(config->display_device, value);
+        }
+    }
 
     json_t *mode = json_object_get(display, "mode");
     if (mode && json_is_string(mode))
@@ -1030,6 +1044,15 @@ static void load_display_from_json(json_t *root, Config *config)
             config->circle_show_extra_info = json_integer_value(extra_info) ? 1 : 0;
     }
 
+    json_t *circle_animation = json_object_get(display, "circle_animation");
+    if (circle_animation)
+    {
+        if (json_is_boolean(circle_animation))
+            config->circle_animation = json_is_true(circle_animation) ? 1 : 0;
+        else if (json_is_integer(circle_animation))
+            config->circle_animation = json_integer_value(circle_animation) ? 1 : 0;
+    }
+
     json_t *background_fit = json_object_get(display, "background_image_fit");
     if (background_fit && json_is_string(background_fit))
     {
@@ -1042,6 +1065,26 @@ static void load_display_from_json(json_t *root, Config *config)
         }
     }
 
+    json_t *upload_mode = json_object_get(display, "upload_mode");
+    if (upload_mode && json_is_string(upload_mode))
+    {
+        const char *value = json_string_value(upload_mode);
+        if (value && (strcmp(value, "auto") == 0 ||
+                      strcmp(value, "memory") == 0 ||
+                      strcmp(value, "file") == 0))
+        {
+            SAFE_STRCPY(config->display_upload_mode, value);
+        }
+    }
+
+    json_t *png_compression = json_object_get(display, "png_compression");
+    if (png_compression && json_is_integer(png_compression))
+    {
+        int val = (int)json_integer_value(png_compression);
+        if (val >= 0 && val <= 9)
+            config->display_png_compression = val;
+    }
+
     json_t *background_overlay =
         json_object_get(display, "background_overlay_opacity");
     if (background_overlay && json_is_number(background_overlay))
@@ -1059,6 +1102,49 @@ static void load_display_from_json(json_t *root, Config *config)
             config->display_refresh_interval = (float)val;
     }
 
+    json_t *force_refresh = json_object_get(display, "force_refresh_interval");
+    if (force_refresh && json_is_integer(force_refresh))
+    {
+        int val = (int)json_integer_value(force_refresh);
+        if (val >= 0 && val <= 3600)
+            config->display_force_refresh_interval = val;
+    }
+
+    json_t *refresh_mode = json_object_get(display, "refresh_mode");
+    if (refresh_mode && json_is_string(refresh_mode))
+    {
+        const char *value = json_string_value(refresh_mode);
+        if (value && (strcmp(value, "fixed") == 0 ||
+                      strcmp(value, "adaptive") == 0))
+        {
+            SAFE_STRCPY(config->display_refresh_mode, value);
+        }
+    }
+
+    json_t *refresh_max = json_object_get(display, "refresh_interval_max");
+    if (refresh_max && json_is_number(refresh_max))
+    {
+        double val = json_number_value(refresh_max);
+        if (val >= 0.2 && val <= 300.0)
+            config->display_refresh_interval_max = (float)val;
+    }
+
+    json_t *adaptive_delta = json_object_get(display, "adaptive_delta");
+    if (adaptive_delta && json_is_number(adaptive_delta))
+    {
+        double val = json_number_value(adaptive_delta);
+        if (val >= 0.0 && val <= 100.0)
+            config->display_adaptive_delta = (float)val;
+    }
+
+    json_t *adaptive_samples = json_object_get(display, "adaptive_samples");
+    if (adaptive_samples && json_is_integer(adaptive_samples))
+    {
+        int val = (int)json_integer_value(adaptive_samples);
+        if (val >= 1 && val <= 100)
+            config->display_adaptive_samples = val;
+    }
+
     json_t *brightness = json_object_get(display, "brightness");
     if (brightness && json_is_integer(brightness))
     {
@@ -1140,6 +1226,18 @@ static void load_display_from_json(json_t *root, Config *config)
     }
 }
 
+/**
+ * @brief Load display settings from JSON.
+ */
+static void load_display_from_json(json_t *root, Config *config)
+{
+    json_t *display = json_object_get(root, "display");
+    if (!display || !json_is_object(display))
+        return;
+
+    load_display_settings(display, config);
+}
+
 /**
  * @brief Load layout settings from JSON.
  */
@@ -1199,6 +1297,23 @@ static void load_layout_from_json(json_t *root, Config *config)
             config->layout_bar_border_enabled = (int)json_integer_value(bar_border_enabled) != 0 ? 1 : 0;
     }
 
+    json_t *sparkline = json_object_get(layout, "sparkline");
+    if (sparkline)
+    {
+        if (json_is_boolean(sparkline))
+            config->layout_sparkline_enabled = json_is_true(sparkline) ? 1 : 0;
+        else if (json_is_integer(sparkline))
+            config->layout_sparkline_enabled = (int)json_integer_value(sparkline) != 0 ? 1 : 0;
+    }
+
+    json_t *sparkline_samples = json_object_get(layout, "sparkline_samples");
+    if (sparkline_samples && json_is_integer(sparkline_samples))
+    {
+        int val = (int)json_integer_value(sparkline_samples);
+        if (val >= 2 && val <= 240)
+            config->layout_sparkline_samples = (uint16_t)val;
+    }
+
     json_t *label_margin_left = json_object_get(layout, "label_margin_left");
     if (label_margin_left && json_is_integer(label_margin_left))
     {
@@ -1542,15 +1657,10 @@ static void write_token_sentinel_to_config(const char *json_path, const Config *
 }
 
 /**
- * @brief Load complete configuration from config.json with hardcoded defaults.
+ * @brief Reset a config to zero and set the "use default" sentinels.
  */
-int load_plugin_config(Config *config, const char *config_path)
+static void init_config_sentinels(Config *config)
 {
-    if (!config)
-    {
-        return 0;
-    }
-
     // Initialize with defaults (memset sets all to 0, including color.is_set = 0)
     memset(config, 0, sizeof(Config));
     config->layout_bar_height = CONFIG_LAYOUT_U16_UNSET;
@@ -1564,9 +1674,44 @@ int load_plugin_config(Config *config, const char *config_path)
     config->layout_bar_border = -1.0f;      // Sentinel for "use default"
     config->layout_bar_opacity = -1.0f;     // Sentinel for "use default"
     config->layout_bar_border_enabled = -1; // Sentinel for "auto" (enabled)
+    config->layout_sparkline_enabled = -1;
+    config->layout_sparkline_samples = CONFIG_LAYOUT_U16_UNSET;
     config->circle_show_extra_info = -1;    // Sentinel for "auto" (enabled)
+    config->circle_animation = -1;
+    config->display_force_refresh_interval = -1;
+    config->display_adaptive_delta = -1.0f; // Sentinel: 0 is a valid delta
+    config->display_png_compression = -1;
     config->display_degree_spacing = -1;
     // Note: All colors have is_set=0 after memset, so defaults will be applied
+}
+
+/**
+ * @brief Apply all config.json sections of a parsed document.
+ */
+static void load_config_sections(json_t *root, Config *config)
+{
+    load_daemon_from_json(root, config);
+    load_paths_from_json(root, config);
+    load_device_detection_from_json(root, config);
+    load_display_from_json(root, config);
+    load_layout_from_json(root, config);
+    load_colors_from_json(root, config);
+    load_font_from_json(root, config);
+    load_sensors_from_json(root, config);
+    load_positioning_from_json(root, config);
+}
+
+/**
+ * @brief Load complete configuration from config.json with hardcoded defaults.
+ */
+int load_plugin_config(Config *config, const char *config_path)
+{
+    if (!config)
+    {
+        return 0;
+    }
+
+    init_config_sentinels(config);
 
     // Try to find and load JSON config
     const char *json_path = find_config_json(config_path);
@@ -1581,15 +1726,7 @@ int load_plugin_config(Config *config, const char *config_path)
 
         if (root)
         {
-            load_daemon_from_json(root, config);
-            load_paths_from_json(root, config);
-            load_device_detection_from_json(root, config);
-            load_display_from_json(root, config);
-            load_layout_from_json(root, config);
-            load_colors_from_json(root, config);
-            load_font_from_json(root, config);
-            load_sensors_from_json(root, config);
-            load_positioning_from_json(root, config);
+            load_config_sections(root, config);
 
             /* Re-format config.json if CoolerControl wrote it compact */
             normalize_config_json(json_path, root);
@@ -1629,3 +1766,235 @@ int load_plugin_config(Config *config, const char *config_path)
 
     return loaded_from_json;
 }
+
+/**
+ * @brief Merge a config fragment into a config document, object by object.
+ * @details Values of the fragment replace those of the target; nested
+ * objects (sections, sensors, colors) are merged recursively.
+ */
+static void merge_config_objects(json_t *target, json_t *fragment)
+{
+    const char *key;
+    json_t *value;
+    json_object_foreach(fragment, key, value)
+    {
+        json_t *existing = json_object_get(target, key);
+        if (json_is_object(value) && json_is_object(existing))
+            merge_config_objects(existing, value);
+        else
+            json_object_set(target, key, value);
+    }
+}
+
+/**
+ * @brief Load config.json with a fragment applied on top, read-only.
+ */
+int load_preview_config(Config *config, const char *config_path,
+                        const char *fragment_path)
+{
+    if (!config)
+        return 0;
+
+    init_config_sentinels(config);
+
+    const char *json_path = find_config_json(config_path);
+    json_error_t error;
+    json_t *root = json_path ? json_load_file(json_path, 0, &error) : NULL;
+    if (!root)
+        root = json_object();
+    if (!root)
+        return 0;
+
+    if (fragment_path)
+    {
+        json_t *fragment = json_load_file(fragment_path, 0, &error);
+        if (!fragment || !json_is_object(fragment))
+        {
+            log_message(LOG_ERROR, "Failed to parse config fragment %s: %s",
+                        fragment_path, fragment ? "not an object" : error.text);
+            json_decref(fragment);
+            json_decref(root);
+            return 0;
+        }
+        merge_config_objects(root, fragment);
+        json_decref(fragment);
+    }
+
+    load_config_sections(root, config);
+    json_decref(root);
+
+    /* Token for live sensor data; credentials.json is only read */
+    if (json_path)
+        load_credentials_file(json_path, config);
+
+    apply_system_defaults(config);
+    return 1;
+}
+
+/**
+ * @brief Path of the config.json that load_plugin_config() reads.
+ */
+const char *find_plugin_config_path(const char *config_path)
+{
+    return find_config_json(config_path);
+}
+
+// ============================================================================
+// Config Diffing
+// ============================================================================
+
+/** @brief Byte range of one Config section. */
+typedef struct
+{
+    config_section_t section;
+    size_t start;
+    size_t end;
+} ConfigSectionRange;
+
+// Struct order; colors are split by the font group
+static const ConfigSectionRange config_section_ranges[] = {
+    {CONFIG_SECTION_DAEMON, offsetof(Config, daemon_address),
+     offsetof(Config, paths_images)},
+    {CONFIG_SECTION_PATHS, offsetof(Config, paths_images),
+     offsetof(Config, device_detection_mode)},
+    {CONFIG_SECTION_DETECTION, offsetof(Config, device_detection_mode),
+     offsetof(Config, display_width)},
+    {CONFIG_SECTION_DISPLAY, offsetof(Config, display_width),
+     offsetof(Config, sensor_slot_1)},
+    {CONFIG_SECTION_SLOTS, offsetof(Config, sensor_slot_1),
+     offsetof(Config, layout_bar_height)},
+    {CONFIG_SECTION_LAYOUT, offsetof(Config, layout_bar_height),
+     offsetof(Config, display_background_color)},
+    {CONFIG_SECTION_COLORS, offsetof(Config, display_background_color),
+     offsetof(Config, font_face)},
+    {CONFIG_SECTION_FONT, offsetof(Config, font_face),
+     offsetof(Config, font_color_temp)},
+    {CONFIG_SECTION_COLORS, offsetof(Config, font_color_temp),
+     offsetof(Config, display_degree_spacing)},
+    {CONFIG_SECTION_LAYOUT, offsetof(Config, display_degree_spacing),
+     offsetof(Config, sensor_configs)},
+    {CONFIG_SECTION_SENSORS, offsetof(Config, sensor_configs), sizeof(Config)},
+};
+
+/**
+ * @brief Compare two configs section by section.
+ */
+unsigned int diff_config_sections(const Config *a, const Config *b)
+{
+    if (!a || !b)
+        return CONFIG_SECTION_ALL;
+
+    const unsigned char *bytes_a = (const unsigned char *)a;
+    const unsigned char *bytes_b = (const unsigned char *)b;
+    unsigned int changed = 0;
+
+    for (size_t i = 0; i < sizeof(config_section_ranges) / sizeof(config_section_ranges[0]); i++)
+    {
+        const ConfigSectionRange *range = &config_section_ranges[i];
+        if (memcmp(bytes_a + range->start, bytes_b + range->start,
+                   range->end - range->start) != 0)
+            changed |= (unsigned int)range->section;
+    }
+
+    return changed;
+}
+
+// ============================================================================
+// Multi-Display Configuration
+// ============================================================================
+
+/**
+ * @brief Give a display its own image file (coolerdash.png -> coolerdash-2.png).
+ * @details Keeps file uploads of several LCDs from overwriting each other.
+ */
+static void set_display_image_path(Config *config)
+{
+    if (config->display_index == 0)
+        return;
+
+    char base_path[CONFIG_MAX_PATH_LEN];
+    SAFE_STRCPY(base_path, config->paths_image_coolerdash);
+
+    const char *slash = strrchr(base_path, '/');
+    char *dot = strrchr(base_path, '.');
+    char extension[16] = ".png";
+    if (dot && (!slash || dot > slash))
+    {
+        SAFE_STRCPY(extension, dot);
+        *dot = '\0';
+    }
+
+    int ret = snprintf(config->paths_image_coolerdash,
+                       sizeof(config->paths_image_coolerdash), "%s-%d%s",
+                       base_path, config->display_index + 1, extension);
+    if (ret < 0 || ret >= (int)sizeof(config->paths_image_coolerdash))
+        log_message(LOG_WARNING, "Display %d image path truncated",
+                    config->display_index + 1);
+}
+
+/**
+ * @brief Build one Config per LCD from the "displays" list of config.json.
+ */
+int load_display_configs(const Config *base, const char *config_path,
+                         Config *displays, int max_displays)
+{
+    if (!base || !displays || max_displays <= 0)
+        return 0;
+
+    if (max_displays > MAX_LCD_DISPLAYS)
+        max_displays = MAX_LCD_DISPLAYS;
+
+    displays[0] = *base;
+    displays[0].display_index = 0;
+
+    const char *json_path = find_config_json(config_path);
+    if (!json_path)
+        return 1;
+
+    json_error_t error;
+    json_t *root = json_load_file(json_path, 0, &error);
+    if (!root)
+        return 1;
+
+    const json_t *entries = json_object_get(root, "displays");
+    if (!entries || !json_is_array(entries) || json_array_size(entries) == 0)
+    {
+        json_decref(root);
+        return 1;
+    }
+
+    int count = 0;
+    const size_t entry_count = json_array_size(entries);
+    for (size_t i = 0; i < entry_count; i++)
+    {
+        json_t *entry = json_array_get(entries, i);
+        if (!entry || !json_is_object(entry))
+        {
+            log_message(LOG_WARNING, "Ignoring displays[%zu]: not an object", i);
+            continue;
+        }
+
+        if (count >= max_displays)
+        {
+            log_message(LOG_WARNING, "More than %d displays configured, ignoring the rest",
+                        max_displays);
+            break;
+        }
+
+        Config *display = &displays[count];
+        *display = *base;
+        display->display_index = count;
+        load_display_settings(entry, display);
+        validate_sensor_slots(display);
+        set_display_image_path(display);
+
+        log_message(LOG_INFO, "Display %d: mode=%s, device=%s", count + 1,
+                    display->display_mode,
+                    display->display_device[0] != '\0' ? display->display_device
+                                                        : "auto");
+        count++;
+    }
+
+    json_decref(root);
+    return (count > 0) ? count : 1;
+}
@@ -26,6 +26,7 @@
 #define CONFIG_MAX_FONT_NAME_LEN 64
 #define CONFIG_MAX_SENSOR_SLOT_LEN 256
 #define CONFIG_MAX_PATTERN_LIST_LEN 512
+#define MAX_LCD_DISPLAYS 4
 #define DEFAULT_COOLERDASH_PLUGIN_DIR "/var/lib/coolercontrol/plugins/coolerdash"
 #define DEFAULT_SHUTDOWN_IMAGE_PATH DEFAULT_COOLERDASH_PLUGIN_DIR "/shutdown.png"
 
@@ -74,12 +75,18 @@ typedef struct
     float label_to_bar_gap;               /**< Gap below bar as % of available_height (0 = auto) */
 } SensorConfig;
 
-/** @brief All CoolerDash settings: daemon, paths, display, theme, sensors. */
+/**
+ * @brief All CoolerDash settings: daemon, paths, display, theme, sensors.
+ * @details Fields are grouped by section in the order listed by
+ * config_section_t; diff_config_sections() compares the groups as byte
+ * ranges, so a new field goes next to the fields of its section.
+ */
 typedef struct Config
 {
     // Daemon configuration
     char daemon_address[CONFIG_MAX_STRING_LEN];
     char access_token[CONFIG_MAX_TOKEN_LEN];
+    char daemon_sensor_source[8]; // "poll" (/status), "sse" (/sse/status stream)
 
     // Paths configuration
     char paths_images[CONFIG_MAX_PATH_LEN];
@@ -96,14 +103,24 @@ typedef struct Config
     uint16_t display_width;
     uint16_t display_height;
     float display_refresh_interval;
+    int display_force_refresh_interval; // Seconds, 0 = upload every frame
+    char display_refresh_mode[16];      // "fixed", "adaptive"
+    float display_refresh_interval_max; // Adaptive: slowest interval (s)
+    float display_adaptive_delta;       // Adaptive: max slot change while steady
+    int display_adaptive_samples;       // Adaptive: steady samples before stretching
     uint8_t lcd_brightness;
     uint16_t lcd_orientation; // 0/90/180/270
     char display_mode[16];
     char display_background_image_fit[16];
+    char display_upload_mode[16]; // "auto", "memory", "file"
+    int display_png_compression;  // zlib level 0-9, 0/1 = fastest
     uint16_t circle_switch_interval;
     int circle_show_extra_info;
+    int circle_animation; // Upload the rotation as one animated GIF
     float display_content_scale_factor;
     float display_background_overlay_opacity;
+    char display_device[CONFIG_MAX_STRING_LEN]; // LCD match pattern, "" = auto
+    int display_index;                          // Position in the displays list
 
     // Sensor slot configuration (flexible sensor assignment)
     char sensor_slot_1[CONFIG_MAX_SENSOR_SLOT_LEN]; // "cpu", "gpu", "liquid", "none"
@@ -119,6 +136,8 @@ typedef struct Config
     float layout_bar_border;
     float layout_bar_opacity;
     int layout_bar_border_enabled; // 1=enabled, 0=disabled, -1=auto (use default)
+    int layout_sparkline_enabled;  // 1=draw history sparkline in bars, 0=off
+    uint16_t layout_sparkline_samples; // Samples shown per sparkline
     uint8_t layout_bar_width;
     uint8_t layout_label_margin_left;
     uint8_t layout_label_margin_bar;
@@ -146,7 +165,22 @@ typedef struct Config
     int sensor_config_count;                         /**< Number of valid entries */
 } Config;
 
-/** @brief Global log function (implemented in config.c, used everywhere). */
+/** @brief Config sections reported by diff_config_sections(). */
+typedef enum
+{
+    CONFIG_SECTION_DAEMON = 1 << 0,    // Address, token, sensor source
+    CONFIG_SECTION_PATHS = 1 << 1,     // Image paths
+    CONFIG_SECTION_DETECTION = 1 << 2, // LCD detection mode and lists
+    CONFIG_SECTION_DISPLAY = 1 << 3,   // Size, refresh, mode, upload, device
+    CONFIG_SECTION_SLOTS = 1 << 4,     // Sensor slot assignment
+    CONFIG_SECTION_LAYOUT = 1 << 5,    // Bars, sparklines, positioning
+    CONFIG_SECTION_COLORS = 1 << 6,    // Background, bar and font colors
+    CONFIG_SECTION_FONT = 1 << 7,      // Font face and sizes
+    CONFIG_SECTION_SENSORS = 1 << 8,   // Per-sensor thresholds and overrides
+    CONFIG_SECTION_ALL = (1 << 9) - 1
+} config_section_t;
+
+/** @brief Global log function (implemented in logger.c, used everywhere). */
 void log_message(log_level_t level, const char *format, ...);
 
 /** @brief Verbose logging flag (set by --verbose CLI arg). */
@@ -191,6 +225,52 @@ static inline int is_valid_orientation(int orientation)
  */
 int load_plugin_config(Config *config, const char *config_path);
 
+/**
+ * @brief Load config.json with a config fragment applied on top (--preview).
+ * @details The fragment is a partial config.json whose values replace those
+ * of the installed config, section by section. Unlike load_plugin_config()
+ * nothing is written: config.json is not normalised and credentials.json is
+ * only read.
+ * @param config Output configuration
+ * @param config_path Path to config.json (falls back to the default paths)
+ * @param fragment_path Partial config.json, or NULL for the config as is
+ * @return 1 on success, 0 if the fragment cannot be parsed
+ */
+int load_preview_config(Config *config, const char *config_path,
+                        const char *fragment_path);
+
+/**
+ * @brief Build one Config per LCD from the "displays" list of config.json.
+ * @details Each entry starts as a copy of the base config and overrides keys
+ * of the "display" section. Without a list the base config drives one LCD.
+ * Displays after the first write their image to a numbered file
+ * (coolerdash-2.png, ...).
+ * @param base Fully loaded base config (see load_plugin_config())
+ * @param config_path Optional path to config.json (NULL = use default location)
+ * @param displays Output array of per-display configs
+ * @param max_displays Capacity of displays (at most MAX_LCD_DISPLAYS used)
+ * @return Number of display configs (at least 1), 0 on invalid parameters
+ */
+int load_display_configs(const Config *base, const char *config_path,
+                         Config *displays, int max_displays);
+
+/**
+ * @brief Path of the config.json that load_plugin_config() reads.
+ * @param config_path Optional path to config.json (NULL = use default location)
+ * @return Existing config.json path, or NULL if none is found
+ */
+const char *find_plugin_config_path(const char *config_path);
+
+/**
+ * @brief Compare two configs section by section.
+ * @details Sections are compared byte-wise, so both configs must come from
+ * the same loading steps (load_plugin_config(), load_display_configs(),
+ * update_config_from_device()). A spurious difference only costs a cache
+ * rebuild.
+ * @return Bit mask of config_section_t values that differ (0 = identical)
+ */
+unsigned int diff_config_sections(const Config *a, const Config *b);
+
 /** @brief Find SensorConfig by sensor_id; returns NULL if not found. */
 const SensorConfig *get_sensor_config(const Config *config, const char *sensor_id);
 
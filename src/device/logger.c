@@ -0,0 +1,543 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Logging backend of log_message().
+ * @details Callers format outside the lock and hold it only to check the
+ * call site budget and copy the line into the ring; all I/O happens in the
+ * writer thread. A full ring drops the line and counts it. Deduplication
+ * state belongs to the writer thread (or the caller in synchronous mode).
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../srv/cc_conf.h"
+#include "config.h"
+#include "logger.h"
+#include "stats.h"
+
+// Queued lines and the longest line kept (longer lines are truncated)
+#define LOG_RING_SIZE 128
+#define LOG_LINE_MAX 1024
+
+// Call sites tracked for rate limiting (about 200 exist), probed linearly
+#define LOG_SITE_TABLE_SIZE 512
+#define LOG_SITE_PROBES 8
+
+// A run of identical lines is reported at least this often
+#define LOG_REPEAT_FLUSH_NS (30ULL * 1000000000ULL)
+
+#define LOG_JOURNAL_SOCKET "/run/systemd/journal/socket"
+
+static const char *const level_names[] = {"INFO", "STATUS", "WARNING", "ERROR"};
+static const char *const level_priorities[] = {"6", "5", "4", "3"};
+
+/** @brief One queued line. */
+typedef struct
+{
+    log_level_t level;
+    unsigned long suppressed; // Lines of this call site dropped before it
+    char text[LOG_LINE_MAX];
+} LogEntry;
+
+/** @brief Rate limit state of one call site, keyed by its format string. */
+typedef struct
+{
+    const char *format;
+    uint64_t window_start_ns;
+    unsigned int count;
+    unsigned long suppressed;
+} LogSite;
+
+static struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t thread;
+    int running;
+    int stop;
+    LogEntry ring[LOG_RING_SIZE];
+    int head;
+    int count;
+    unsigned long dropped;
+    LogSite sites[LOG_SITE_TABLE_SIZE];
+    int journal_fd;
+} logger = {.lock = PTHREAD_MUTEX_INITIALIZER, .journal_fd = -1};
+
+// Last written line, for "last message repeated N times"
+static struct
+{
+    int valid;
+    log_level_t level;
+    char text[LOG_LINE_MAX];
+    unsigned long repeats;
+    uint64_t since_ns;
+} last_line;
+
+// ============================================================================
+// Sinks
+// ============================================================================
+
+/**
+ * @brief Send a line to the journal with structured fields.
+ * @details MESSAGE uses the binary field form, so embedded newlines survive.
+ * @param field Extra numeric field name, or NULL
+ * @return 1 if sent, 0 to fall back to stdio
+ */
+static int send_journal_line(log_level_t level, const char *text,
+                             const char *field, unsigned long value)
+{
+    char buffer[LOG_LINE_MAX + 256];
+    int header = snprintf(buffer, sizeof(buffer),
+                          "PRIORITY=%s\nSYSLOG_IDENTIFIER=coolerdash\n"
+                          "COOLERDASH_LEVEL=%s\n",
+                          level_priorities[level], level_names[level]);
+    if (header < 0)
+        return 0;
+    size_t used = (size_t)header;
+
+    if (field)
+    {
+        header = snprintf(buffer + used, sizeof(buffer) - used, "%s=%lu\n",
+                          field, value);
+        if (header < 0)
+            return 0;
+        used += (size_t)header;
+    }
+
+    size_t length = strlen(text);
+    while (length > 0 && text[length - 1] == '\n')
+        length--;
+    if (used + 8 + 8 + length + 1 > sizeof(buffer))
+        return 0;
+
+    memcpy(buffer + used, "MESSAGE\n", 8);
+    used += 8;
+    for (int i = 0; i < 8; i++)
+        buffer[used++] = (char)(((uint64_t)length >> (8 * i)) & 0xff);
+    memcpy(buffer + used, text, length);
+    used += length;
+    buffer[used++] = '\n';
+
+    return send(logger.journal_fd, buffer, used, 0) == (ssize_t)used;
+}
+
+/**
+ * @brief Write one line to the journal or stdout/stderr.
+ * @param field Structured journal field of a note line, or NULL
+ */
+static void write_log_line(log_level_t level, const char *text,
+                           const char *field, unsigned long value)
+{
+    if (logger.journal_fd >= 0 &&
+        send_journal_line(level, text, field, value))
+        return;
+
+    FILE *output = (level == LOG_ERROR) ? stderr : stdout;
+
+    // Keep lines of synchronous callers intact
+    flockfile(output);
+    fprintf(output, "[CoolerDash %s] ", level_names[level]);
+    fputs(text, output);
+    fputc('\n', output);
+    fflush(output);
+    funlockfile(output);
+}
+
+/** @brief Write a note about lines that were not written. */
+static void write_log_note(log_level_t level, const char *field,
+                           unsigned long value, const char *format, ...)
+{
+    char text[LOG_LINE_MAX];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    write_log_line(level, text, field, value);
+}
+
+/** @brief Report a pending run of repeated lines. */
+static void flush_repeats(void)
+{
+    if (last_line.repeats == 0)
+        return;
+
+    write_log_note(last_line.level, "COOLERDASH_REPEATED", last_line.repeats,
+                   "Last message repeated %lu times", last_line.repeats);
+    last_line.repeats = 0;
+}
+
+/** @brief Write an entry, collapsing it into the run of an identical line. */
+static void emit_log_entry(const LogEntry *entry)
+{
+    if (entry->suppressed == 0 && last_line.valid &&
+        entry->level == last_line.level && strcmp(entry->text, last_line.text) == 0)
+    {
+        const uint64_t now_ns = stats_clock_ns();
+        if (last_line.repeats++ == 0)
+            last_line.since_ns = now_ns;
+        else if (now_ns - last_line.since_ns >= LOG_REPEAT_FLUSH_NS)
+        {
+            flush_repeats();
+            last_line.since_ns = now_ns;
+        }
+        return;
+    }
+
+    flush_repeats();
+    if (entry->suppressed > 0)
+        write_log_note(entry->level, "COOLERDASH_SUPPRESSED", entry->suppressed,
+                       "%lu similar messages suppressed (more than %d in %ds)",
+                       entry->suppressed, LOG_RATE_BURST, LOG_RATE_WINDOW_S);
+    write_log_line(entry->level, entry->text, NULL, 0);
+
+    last_line.valid = 1;
+    last_line.level = entry->level;
+    memcpy(last_line.text, entry->text, strlen(entry->text) + 1);
+}
+
+// ============================================================================
+// Rate Limiting
+// ============================================================================
+
+/** @brief Table slot of a call site, or NULL if the table is crowded. Caller holds the lock. */
+static LogSite *find_log_site(const char *format)
+{
+    uint64_t hash = (uint64_t)(uintptr_t)format;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    for (int probe = 0; probe < LOG_SITE_PROBES; probe++)
+    {
+        LogSite *site = &logger.sites[(hash + (uint64_t)probe) % LOG_SITE_TABLE_SIZE];
+        if (site->format == format)
+            return site;
+        if (!site->format)
+        {
+            site->format = format;
+            return site;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Charge a line to its call site budget. Caller holds the lock.
+ * @param suppressed Set to the lines dropped in the site's previous window
+ * @return 1 if the line may be logged, 0 if it is suppressed
+ */
+static int take_log_budget(const char *format, unsigned long *suppressed)
+{
+    LogSite *site = find_log_site(format);
+    if (!site)
+        return 1;
+
+    const uint64_t now_ns = stats_clock_ns();
+    if (site->count == 0 ||
+        now_ns - site->window_start_ns >= (uint64_t)LOG_RATE_WINDOW_S * 1000000000ULL)
+    {
+        *suppressed = site->suppressed;
+        site->suppressed = 0;
+        site->window_start_ns = now_ns;
+        site->count = 0;
+    }
+
+    if (site->count >= LOG_RATE_BURST)
+    {
+        site->suppressed++;
+        return 0;
+    }
+    site->count++;
+    return 1;
+}
+
+/** @brief Report call sites whose last lines were suppressed (at shutdown). */
+static void report_suppressed_sites(void)
+{
+    for (int i = 0; i < LOG_SITE_TABLE_SIZE; i++)
+    {
+        pthread_mutex_lock(&logger.lock);
+        LogSite site = logger.sites[i];
+        logger.sites[i].suppressed = 0;
+        pthread_mutex_unlock(&logger.lock);
+
+        if (site.suppressed > 0)
+            write_log_note(LOG_STATUS, "COOLERDASH_SUPPRESSED", site.suppressed,
+                           "%lu messages suppressed: %s", site.suppressed,
+                           site.format);
+    }
+}
+
+// ============================================================================
+// Public API Implementation
+// ============================================================================
+
+/** @brief Global log_message implementation for all modules. */
+void log_message(log_level_t level, const char *format, ...)
+{
+    if (level == LOG_INFO && !verbose_logging)
+    {
+        return;
+    }
+    if ((int)level < LOG_INFO || level > LOG_ERROR)
+        level = LOG_ERROR;
+    if (!format)
+        format = "(null)";
+
+    unsigned long suppressed = 0;
+    pthread_mutex_lock(&logger.lock);
+    const int allowed = take_log_budget(format, &suppressed);
+    pthread_mutex_unlock(&logger.lock);
+    if (!allowed)
+        return;
+
+    char text[LOG_LINE_MAX];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    pthread_mutex_lock(&logger.lock);
+    if (logger.running)
+    {
+        if (logger.count < LOG_RING_SIZE)
+        {
+            LogEntry *entry =
+                &logger.ring[(logger.head + logger.count) % LOG_RING_SIZE];
+            entry->level = level;
+            entry->suppressed = suppressed;
+            memcpy(entry->text, text, strlen(text) + 1);
+            logger.count++;
+            pthread_cond_signal(&logger.cond);
+        }
+        else
+        {
+            logger.dropped++;
+        }
+        pthread_mutex_unlock(&logger.lock);
+        return;
+    }
+    pthread_mutex_unlock(&logger.lock);
+
+    // No writer thread: write in the caller, without deduplication
+    if (suppressed > 0)
+        write_log_note(level, "COOLERDASH_SUPPRESSED", suppressed,
+                       "%lu similar messages suppressed (more than %d in %ds)",
+                       suppressed, LOG_RATE_BURST, LOG_RATE_WINDOW_S);
+    write_log_line(level, text, NULL, 0);
+}
+
+// ============================================================================
+// Writer Thread
+// ============================================================================
+
+/** @brief Absolute monotonic time of a nanosecond timestamp. */
+static struct timespec timespec_from_ns(uint64_t ns)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    return ts;
+}
+
+/**
+ * @brief Write queued lines until stop_logger().
+ * @details While a run of repeated lines is pending the wait times out, so
+ * the repeat count is written even if nothing else is logged.
+ */
+static void *run_logger(void *arg)
+{
+    (void)arg;
+    static LogEntry entry;
+
+    pthread_mutex_lock(&logger.lock);
+    for (;;)
+    {
+        const unsigned long dropped = logger.dropped;
+        logger.dropped = 0;
+
+        if (logger.count > 0)
+        {
+            entry = logger.ring[logger.head];
+            logger.head = (logger.head + 1) % LOG_RING_SIZE;
+            logger.count--;
+            pthread_mutex_unlock(&logger.lock);
+
+            if (dropped > 0)
+            {
+                flush_repeats();
+                write_log_note(LOG_WARNING, "COOLERDASH_DROPPED", dropped,
+                               "%lu log messages dropped (queue full)", dropped);
+            }
+            emit_log_entry(&entry);
+
+            pthread_mutex_lock(&logger.lock);
+            continue;
+        }
+
+        if (dropped > 0)
+        {
+            pthread_mutex_unlock(&logger.lock);
+            write_log_note(LOG_WARNING, "COOLERDASH_DROPPED", dropped,
+                           "%lu log messages dropped (queue full)", dropped);
+            pthread_mutex_lock(&logger.lock);
+            continue;
+        }
+
+        if (logger.stop)
+            break;
+
+        if (last_line.repeats == 0)
+        {
+            pthread_cond_wait(&logger.cond, &logger.lock);
+            continue;
+        }
+
+        const struct timespec deadline =
+            timespec_from_ns(last_line.since_ns + LOG_REPEAT_FLUSH_NS);
+        if (pthread_cond_timedwait(&logger.cond, &logger.lock, &deadline) ==
+                ETIMEDOUT &&
+            logger.count == 0)
+        {
+            pthread_mutex_unlock(&logger.lock);
+            flush_repeats();
+            pthread_mutex_lock(&logger.lock);
+        }
+    }
+    pthread_mutex_unlock(&logger.lock);
+
+    flush_repeats();
+    return NULL;
+}
+
+/**
+ * @brief Check whether stderr is connected to the journal.
+ * @details systemd sets JOURNAL_STREAM to the device and inode of the
+ * stream it connected; a redirected stderr no longer matches.
+ */
+static int stderr_is_journal(void)
+{
+    const char *stream = getenv("JOURNAL_STREAM");
+    unsigned long long device = 0, inode = 0;
+    if (!stream || sscanf(stream, "%llu:%llu", &device, &inode) != 2)
+        return 0;
+
+    struct stat st;
+    if (fstat(STDERR_FILENO, &st) != 0)
+        return 0;
+    return (unsigned long long)st.st_dev == device &&
+           (unsigned long long)st.st_ino == inode;
+}
+
+/** @brief Connect the native journal socket, or return -1. */
+static int open_journal_socket(void)
+{
+    const int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd < 0)
+        return -1;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    cc_safe_strcpy(address.sun_path, sizeof(address.sun_path),
+                   LOG_JOURNAL_SOCKET);
+    if (connect(fd, (const struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int start_logger(void)
+{
+    if (logger.running)
+        return 1;
+
+    if (stderr_is_journal())
+        logger.journal_fd = open_journal_socket();
+
+    // Monotonic timed waits, immune to wall clock changes
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    const int cond_result = pthread_cond_init(&logger.cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    if (cond_result != 0)
+        return 0;
+
+    // Signals stay with the main thread
+    sigset_t all_signals, old_mask;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &old_mask);
+    logger.stop = 0;
+    const int err = pthread_create(&logger.thread, NULL, run_logger, NULL);
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+
+    if (err != 0)
+    {
+        pthread_cond_destroy(&logger.cond);
+        log_message(LOG_WARNING, "Failed to start log thread: %s", strerror(err));
+        return 0;
+    }
+
+    pthread_mutex_lock(&logger.lock);
+    logger.running = 1;
+    pthread_mutex_unlock(&logger.lock);
+
+    if (logger.journal_fd >= 0)
+        log_message(LOG_INFO, "Logging to the journal natively");
+    return 1;
+}
+
+void stop_logger(void)
+{
+    pthread_mutex_lock(&logger.lock);
+    if (!logger.running)
+    {
+        pthread_mutex_unlock(&logger.lock);
+        return;
+    }
+    // Later lines are written by their callers
+    logger.running = 0;
+    logger.stop = 1;
+    pthread_cond_signal(&logger.cond);
+    pthread_mutex_unlock(&logger.lock);
+
+    pthread_join(logger.thread, NULL);
+    pthread_cond_destroy(&logger.cond);
+
+    report_suppressed_sites();
+
+    if (logger.journal_fd >= 0)
+        close(logger.journal_fd);
+    logger.journal_fd = -1;
+}
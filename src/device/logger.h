@@ -0,0 +1,42 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Logging backend of log_message().
+ * @details Lines are formatted by the caller and queued in a fixed ring that
+ * a background thread writes out, so pipeline threads never wait on stdout
+ * or the journal. Each call site (format string) may log LOG_RATE_BURST
+ * lines per LOG_RATE_WINDOW_S seconds; the rest is counted and reported.
+ * Identical consecutive lines are collapsed into "last message repeated N
+ * times". When stderr is connected to the journal, lines are sent natively
+ * with PRIORITY and COOLERDASH_* fields. Before start_logger() and after
+ * stop_logger() log_message() writes synchronously.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+// Lines per call site and window before further lines are suppressed
+#define LOG_RATE_BURST 20
+#define LOG_RATE_WINDOW_S 10
+
+/**
+ * @brief Start the background writer.
+ * @details Uses the native journal protocol if stderr is a journal stream
+ * (JOURNAL_STREAM), stdout/stderr otherwise.
+ * @return 1 on success, 0 if logging stays synchronous
+ */
+int start_logger(void);
+
+/**
+ * @brief Write all queued lines, report suppressed counts, stop the writer.
+ */
+void stop_logger(void);
+
+#endif // LOGGER_H
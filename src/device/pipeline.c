@@ -0,0 +1,680 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Pipelined fetch, render and upload stages.
+ * @details The fetch stage polls /status on the refresh interval (fixed or
+ * adapted to how fast the slot values change) or follows the /sse/status
+ * stream, the render
+ * stage turns the latest sensor data into one encoded frame per display and
+ * the upload stage sends the latest frames. Mailboxes swap buffer pointers, so
+ * values are never copied; with the long-lived frame canvases and response
+ * buffers the steady state does not allocate, which the upload stage checks
+ * against the frame-loop allocation counter.
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <math.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../mods/display.h"
+#include "../srv/cc_conf.h"
+#include "../srv/cc_main.h"
+#include "../srv/cc_sensor.h"
+#include "config.h"
+#include "pipeline.h"
+#include "stats.h"
+
+#define PIPELINE_STAGE_COUNT 3
+#define ADAPTIVE_SLOT_COUNT (3 * MAX_LCD_DISPLAYS)
+
+// Uploaded frames before buffers are expected to have reached their capacity
+#define ALLOCATION_WARMUP_FRAMES 5
+
+/**
+ * @brief Single-slot mailbox holding the latest value.
+ * @details Producer and consumer each own one buffer and swap it with the
+ * mailbox buffer. Publishing into a full mailbox replaces the stale value.
+ */
+typedef struct
+{
+    void *slot;
+    int full;
+} mailbox_t;
+
+/**
+ * @brief Pipeline state shared by all stages.
+ * @details One mutex and condition variable guard the mailboxes and the
+ * pause/stop flags. The display configs are only read while the stages run.
+ * A frame buffer holds one DisplayFrame per display.
+ */
+static struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t threads[PIPELINE_STAGE_COUNT];
+    int thread_count;
+    int stop;
+    int pause;
+    int parked;
+    unsigned long generation;
+    int stream_unsupported; // coolercontrold lacks /sse/status
+    const Config *displays;
+    int display_count;
+    mailbox_t sensors;
+    mailbox_t frames;
+    monitor_sensor_data_t sensor_buffers[3];
+    DisplayFrame frame_buffers[3][MAX_LCD_DISPLAYS];
+} pipeline = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+/**
+ * @brief Adaptive refresh state, owned by the fetch stage.
+ * @details reference holds each slot's value at the start of the current
+ * steady run, band its threshold band at the last fetch. Reset while the
+ * stages are parked or not yet started.
+ */
+static struct
+{
+    float interval;
+    int steady_samples;
+    int primed;
+    float reference[ADAPTIVE_SLOT_COUNT];
+    int band[ADAPTIVE_SLOT_COUNT];
+} adaptive_refresh;
+
+/**
+ * @brief Steady-state allocation check, owned by the upload stage.
+ * @details baseline is the frame-loop allocation count after the warm-up
+ * frames; growth beyond it means a buffer is still allocated per frame.
+ * Reset while the stages are parked or not yet started.
+ */
+static struct
+{
+    int frames;
+    unsigned long baseline;
+    unsigned long reported;
+} allocation_check;
+
+// ============================================================================
+// Mailboxes
+// ============================================================================
+
+/**
+ * @brief Publish a value and get the mailbox buffer back. Caller holds lock.
+ * @return 1 if an unconsumed value was replaced, 0 otherwise
+ */
+static int mailbox_put(mailbox_t *mailbox, void **buffer)
+{
+    void *previous = mailbox->slot;
+    mailbox->slot = *buffer;
+    *buffer = previous;
+
+    const int replaced = mailbox->full;
+    mailbox->full = 1;
+    pthread_cond_broadcast(&pipeline.cond);
+    return replaced;
+}
+
+/** @brief Park the calling stage while a pause is requested. Caller holds lock. */
+static void park_stage(void)
+{
+    pipeline.parked++;
+    pthread_cond_broadcast(&pipeline.cond);
+    while (pipeline.pause && !pipeline.stop)
+        pthread_cond_wait(&pipeline.cond, &pipeline.lock);
+    pipeline.parked--;
+}
+
+/**
+ * @brief Wait for the next mailbox value and swap it into buffer.
+ * @return 1 if a value was taken, 0 if the pipeline stops
+ */
+static int mailbox_take(mailbox_t *mailbox, void **buffer)
+{
+    pthread_mutex_lock(&pipeline.lock);
+    for (;;)
+    {
+        if (pipeline.stop)
+        {
+            pthread_mutex_unlock(&pipeline.lock);
+            return 0;
+        }
+        if (pipeline.pause)
+        {
+            park_stage();
+            continue;
+        }
+        if (mailbox->full)
+            break;
+        pthread_cond_wait(&pipeline.cond, &pipeline.lock);
+    }
+
+    void *value = mailbox->slot;
+    mailbox->slot = *buffer;
+    *buffer = value;
+    mailbox->full = 0;
+    pthread_mutex_unlock(&pipeline.lock);
+    return 1;
+}
+
+// ============================================================================
+// Fetch Schedule
+// ============================================================================
+
+/** @brief Check whether timestamp a is before timestamp b. */
+static int timespec_before(const struct timespec *a, const struct timespec *b)
+{
+    return a->tv_sec < b->tv_sec ||
+           (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/**
+ * @brief Advance the next fetch time by whole intervals past now.
+ * @details Ticks missed by a slow fetch are skipped instead of bursting.
+ */
+static void advance_schedule(struct timespec *next, float interval)
+{
+    const long interval_sec = (long)interval;
+    const long interval_nsec = (long)((interval - (float)interval_sec) * 1e9f);
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    do
+    {
+        next->tv_sec += interval_sec;
+        next->tv_nsec += interval_nsec;
+        if (next->tv_nsec >= 1000000000L)
+        {
+            next->tv_sec++;
+            next->tv_nsec -= 1000000000L;
+        }
+    } while (!timespec_before(&now, next));
+}
+
+// ============================================================================
+// Adaptive Refresh
+// ============================================================================
+
+/**
+ * @brief Slowest interval of the adaptive mode.
+ * @details Circle mode rotates sensors on render ticks, so the interval never
+ * exceeds a circle display's switch interval, unless the LCD plays the
+ * rotation as an animation.
+ */
+static float adaptive_max_interval(const Config *config)
+{
+    float max_interval = config->display_refresh_interval_max;
+    for (int i = 0; i < pipeline.display_count; i++)
+    {
+        const Config *display = &pipeline.displays[i];
+        if (strcmp(display->display_mode, "circle") == 0 &&
+            !is_circle_animated(display) &&
+            max_interval > (float)display->circle_switch_interval)
+            max_interval = (float)display->circle_switch_interval;
+    }
+    return (max_interval > config->display_refresh_interval)
+               ? max_interval
+               : config->display_refresh_interval;
+}
+
+/**
+ * @brief Interval until the next fetch.
+ * @details In adaptive mode the interval doubles (up to refresh_interval_max)
+ * once every active slot stayed within adaptive_delta for adaptive_samples
+ * fetches, and snaps back to refresh_interval as soon as a slot moves further
+ * or crosses a threshold band (bar color). Settings come from the first
+ * display, like the refresh interval.
+ * @param data Fetched sensor data, or NULL if the fetch failed
+ */
+static float next_fetch_interval(const monitor_sensor_data_t *data)
+{
+    const Config *config = &pipeline.displays[0];
+    const float fast = config->display_refresh_interval;
+    if (strcmp(config->display_refresh_mode, "adaptive") != 0)
+        return fast;
+    if (!data)
+        return adaptive_refresh.primed ? adaptive_refresh.interval : fast;
+
+    float values[ADAPTIVE_SLOT_COUNT] = {0};
+    int moved = 0;
+    for (int d = 0; d < pipeline.display_count; d++)
+    {
+        const Config *display = &pipeline.displays[d];
+        const char *slots[3] = {display->sensor_slot_1, display->sensor_slot_2,
+                                display->sensor_slot_3};
+        for (int s = 0; s < 3; s++)
+        {
+            const int i = d * 3 + s;
+            if (!slot_is_active(slots[s]))
+                continue;
+
+            values[i] = get_slot_temperature(data, slots[s]);
+            const int band = get_slot_threshold_band(display, slots[s], values[i]);
+            if (adaptive_refresh.primed &&
+                (band != adaptive_refresh.band[i] ||
+                 fabsf(values[i] - adaptive_refresh.reference[i]) >
+                     config->display_adaptive_delta))
+                moved = 1;
+            adaptive_refresh.band[i] = band;
+        }
+    }
+
+    const float previous = adaptive_refresh.interval;
+    float interval;
+    if (!adaptive_refresh.primed || moved)
+    {
+        memcpy(adaptive_refresh.reference, values, sizeof(values));
+        adaptive_refresh.steady_samples = 0;
+        adaptive_refresh.primed = 1;
+        interval = fast;
+    }
+    else if (++adaptive_refresh.steady_samples >= config->display_adaptive_samples)
+    {
+        const float max_interval = adaptive_max_interval(config);
+        interval = (previous * 2.0f < max_interval) ? previous * 2.0f : max_interval;
+    }
+    else
+    {
+        interval = previous;
+    }
+
+    if (interval != previous && previous > 0.0f)
+        log_message(LOG_INFO, "Adaptive refresh: %.2fs -> %.2fs (%s)", previous,
+                    interval, moved ? "values changed" : "values steady");
+    adaptive_refresh.interval = interval;
+    return interval;
+}
+
+/**
+ * @brief Wait until the next fetch is due.
+ * @details Fetches immediately after start and resume.
+ * @return 1 if a fetch is due, 0 if the pipeline stops
+ */
+static int wait_for_fetch(struct timespec *next, unsigned long *generation)
+{
+    pthread_mutex_lock(&pipeline.lock);
+    for (;;)
+    {
+        if (pipeline.stop)
+        {
+            pthread_mutex_unlock(&pipeline.lock);
+            return 0;
+        }
+        if (pipeline.pause)
+        {
+            park_stage();
+            continue;
+        }
+        if (*generation != pipeline.generation)
+        {
+            *generation = pipeline.generation;
+            clock_gettime(CLOCK_MONOTONIC, next);
+            break;
+        }
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (!timespec_before(&now, next))
+            break;
+        pthread_cond_timedwait(&pipeline.cond, &pipeline.lock, next);
+    }
+    pthread_mutex_unlock(&pipeline.lock);
+    return 1;
+}
+
+// ============================================================================
+// Stages
+// ============================================================================
+
+/** @brief Stream handler: publish streamed sensor data to the render stage. */
+static int publish_streamed_sensors(const monitor_sensor_data_t *data,
+                                    void *context)
+{
+    void **buffer = context;
+    copy_sensor_data(*buffer, data);
+
+    pthread_mutex_lock(&pipeline.lock);
+    const int replaced = mailbox_put(&pipeline.sensors, buffer);
+    pthread_mutex_unlock(&pipeline.lock);
+
+    if (replaced)
+        log_message(LOG_INFO, "Render busy, replaced unrendered sensor data");
+    return 1;
+}
+
+/** @brief Stream handler: end the stream on pause and stop. */
+static int stream_interrupted(void *context)
+{
+    (void)context;
+    pthread_mutex_lock(&pipeline.lock);
+    const int interrupted = pipeline.stop || pipeline.pause;
+    pthread_mutex_unlock(&pipeline.lock);
+    return interrupted;
+}
+
+/**
+ * @brief Follow the /sse/status stream until it ends.
+ * @return 1 if the stage should poll once (stream lost or unsupported), 0 if
+ * the stream was interrupted by pause or stop
+ */
+static int follow_sensor_stream(void **buffer)
+{
+    const sensor_stream_handler_t handler = {publish_streamed_sensors,
+                                             stream_interrupted, buffer};
+    const sensor_stream_result_t result = stream_sensor_monitor_data(
+        pipeline.displays, pipeline.display_count, &handler);
+
+    if (result == SENSOR_STREAM_STOPPED)
+        return 0;
+    if (result == SENSOR_STREAM_UNSUPPORTED)
+        pipeline.stream_unsupported = 1;
+    return 1;
+}
+
+/**
+ * @brief Resync after the circuit breaker closed again.
+ * @details A restarted coolercontrold may have new status timestamps, device
+ * names and LCD state: polling restarts from the epoch, the device cache is
+ * re-validated and the frame cache cleared, so the next frame is uploaded
+ * even if it looks like the last one before the outage. The daemon may also
+ * have been upgraded, so the status stream is tried again.
+ */
+static void resync_after_outage(void)
+{
+    restart_status_polling();
+    revalidate_device_cache();
+    reset_frame_cache();
+    memset(&adaptive_refresh, 0, sizeof(adaptive_refresh));
+    pipeline.stream_unsupported = 0;
+}
+
+/**
+ * @brief Fetch stage: poll sensors on the refresh interval.
+ * @details One fetch per tick is shared by all displays; the interval comes
+ * from the first display and next_fetch_interval(). With sensor_source "sse"
+ * the stage follows the status stream instead; while it is down, it polls
+ * once per interval and reconnects on the next tick. While the circuit
+ * breaker is open, ticks only check it, so nothing is fetched, rendered or
+ * uploaded until the health probe succeeds.
+ */
+static void *fetch_stage(void *arg)
+{
+    (void)arg;
+    void *buffer = &pipeline.sensor_buffers[0];
+    struct timespec next = {0};
+    unsigned long generation = 0;
+
+    while (wait_for_fetch(&next, &generation))
+    {
+        const cc_circuit_state circuit = cc_check_circuit(&pipeline.displays[0]);
+        if (circuit == CC_CIRCUIT_OPEN)
+        {
+            advance_schedule(&next, pipeline.displays[0].display_refresh_interval);
+            continue;
+        }
+        if (circuit == CC_CIRCUIT_RECOVERED)
+            resync_after_outage();
+
+        if (strcmp(pipeline.displays[0].daemon_sensor_source, "sse") == 0 &&
+            !pipeline.stream_unsupported && !follow_sensor_stream(&buffer))
+            continue;
+
+        const int fetched = get_sensor_monitor_data(
+            pipeline.displays, pipeline.display_count, buffer);
+        advance_schedule(&next, next_fetch_interval(fetched ? buffer : NULL));
+
+        if (!fetched)
+        {
+            log_message(LOG_WARNING, "Failed to retrieve sensor data");
+            continue;
+        }
+
+        pthread_mutex_lock(&pipeline.lock);
+        const int replaced = mailbox_put(&pipeline.sensors, &buffer);
+        pthread_mutex_unlock(&pipeline.lock);
+
+        if (replaced)
+            log_message(LOG_INFO, "Render busy, replaced unrendered sensor data");
+    }
+
+    return NULL;
+}
+
+/** @brief Render stage: turn the latest sensor data into encoded frames. */
+static void *render_stage(void *arg)
+{
+    (void)arg;
+    void *data = &pipeline.sensor_buffers[1];
+    void *frames = pipeline.frame_buffers[0];
+
+    while (mailbox_take(&pipeline.sensors, &data))
+    {
+        DisplayFrame *current = frames;
+        int changed = 0;
+        for (int i = 0; i < pipeline.display_count; i++)
+        {
+            if (!render_display_frame(&pipeline.displays[i], data, &current[i]))
+                current[i].changed = 0;
+            changed |= current[i].changed;
+        }
+
+        if (!changed)
+        {
+            log_message(LOG_INFO, "Frame unchanged, skipping LCD upload");
+            continue;
+        }
+
+        pthread_mutex_lock(&pipeline.lock);
+        const int replaced = mailbox_put(&pipeline.frames, &frames);
+        pthread_mutex_unlock(&pipeline.lock);
+
+        if (replaced)
+            log_message(LOG_INFO, "Upload busy, dropped stale frame");
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Verify that the frame loop stopped allocating after warm-up.
+ * @details Growth is reported once per new count; a response that outgrows
+ * its buffer legitimately raises the high-water capacity.
+ */
+static void check_steady_allocations(void)
+{
+    const unsigned long count = get_allocation_count();
+    if (allocation_check.frames < ALLOCATION_WARMUP_FRAMES)
+    {
+        if (++allocation_check.frames == ALLOCATION_WARMUP_FRAMES)
+            allocation_check.baseline = allocation_check.reported = count;
+        return;
+    }
+
+    if (count != allocation_check.reported)
+    {
+        log_message(LOG_INFO, "Frame loop allocated %lu buffer(s) after warm-up",
+                    count - allocation_check.baseline);
+        allocation_check.reported = count;
+    }
+}
+
+/** @brief Upload stage: send the latest changed frames to their LCDs. */
+static void *upload_stage(void *arg)
+{
+    (void)arg;
+    void *frames = pipeline.frame_buffers[1];
+
+    while (mailbox_take(&pipeline.frames, &frames))
+    {
+        const DisplayFrame *current = frames;
+        for (int i = 0; i < pipeline.display_count; i++)
+        {
+            if (current[i].changed)
+                upload_display_frame(&pipeline.displays[i], &current[i]);
+        }
+        check_steady_allocations();
+        log_stats_if_due();
+    }
+
+    return NULL;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+/**
+ * @brief Start the fetch, render and upload threads.
+ */
+int start_pipeline(const Config *displays, int display_count)
+{
+    if (!displays || display_count <= 0 || display_count > MAX_LCD_DISPLAYS ||
+        pipeline.thread_count > 0)
+        return 0;
+
+    pipeline.displays = displays;
+    pipeline.display_count = display_count;
+    pipeline.stop = 0;
+    pipeline.pause = 0;
+    pipeline.parked = 0;
+    pipeline.generation = 1;
+    pipeline.stream_unsupported = 0;
+    pipeline.sensors.slot = &pipeline.sensor_buffers[2];
+    pipeline.sensors.full = 0;
+    pipeline.frames.slot = pipeline.frame_buffers[2];
+    pipeline.frames.full = 0;
+    memset(&adaptive_refresh, 0, sizeof(adaptive_refresh));
+    memset(&allocation_check, 0, sizeof(allocation_check));
+
+    // Monotonic timed waits, immune to wall clock changes
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    const int cond_result = pthread_cond_init(&pipeline.cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    if (cond_result != 0)
+    {
+        log_message(LOG_ERROR, "Failed to init pipeline: %s",
+                    strerror(cond_result));
+        return 0;
+    }
+
+    // Signals stay with the main thread
+    sigset_t all_signals, old_mask;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &old_mask);
+
+    void *(*const stages[PIPELINE_STAGE_COUNT])(void *) = {
+        fetch_stage, render_stage, upload_stage};
+    int result = 1;
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++)
+    {
+        const int err = pthread_create(&pipeline.threads[i], NULL, stages[i],
+                                       NULL);
+        if (err != 0)
+        {
+            log_message(LOG_ERROR, "Failed to start pipeline thread: %s",
+                        strerror(err));
+            result = 0;
+            break;
+        }
+        pipeline.thread_count++;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+
+    if (!result)
+    {
+        stop_pipeline();
+        return 0;
+    }
+
+    log_message(LOG_INFO, "Pipeline started (fetch, render, upload) for %d display(s)",
+                display_count);
+    return 1;
+}
+
+/**
+ * @brief Park all stages between work items.
+ */
+void pause_pipeline(void)
+{
+    pthread_mutex_lock(&pipeline.lock);
+    pipeline.pause = 1;
+    pthread_cond_broadcast(&pipeline.cond);
+    while (pipeline.parked < pipeline.thread_count)
+        pthread_cond_wait(&pipeline.cond, &pipeline.lock);
+    pthread_mutex_unlock(&pipeline.lock);
+}
+
+/**
+ * @brief Resume parked stages with the reloaded display configs.
+ */
+void resume_pipeline(const Config *displays, int display_count)
+{
+    pthread_mutex_lock(&pipeline.lock);
+    if (displays && display_count > 0 && display_count <= MAX_LCD_DISPLAYS)
+    {
+        pipeline.displays = displays;
+        pipeline.display_count = display_count;
+    }
+    pipeline.sensors.full = 0;
+    pipeline.frames.full = 0;
+    memset(&adaptive_refresh, 0, sizeof(adaptive_refresh));
+    memset(&allocation_check, 0, sizeof(allocation_check));
+    pipeline.stream_unsupported = 0;
+    pipeline.generation++;
+    pipeline.pause = 0;
+    pthread_cond_broadcast(&pipeline.cond);
+    pthread_mutex_unlock(&pipeline.lock);
+}
+
+/**
+ * @brief Stop all stages and join the threads.
+ */
+void stop_pipeline(void)
+{
+    if (pipeline.thread_count == 0)
+        return;
+
+    pthread_mutex_lock(&pipeline.lock);
+    pipeline.stop = 1;
+    pthread_cond_broadcast(&pipeline.cond);
+    pthread_mutex_unlock(&pipeline.lock);
+
+    // Do not wait for the deadline of a fetch or upload in flight
+    cc_abort_transfers();
+
+    for (int i = 0; i < pipeline.thread_count; i++)
+        pthread_join(pipeline.threads[i], NULL);
+    pipeline.thread_count = 0;
+
+    const unsigned long allocations = get_allocation_count();
+    if (allocation_check.frames >= ALLOCATION_WARMUP_FRAMES)
+        log_message(LOG_INFO,
+                    "Frame loop allocations: %lu total, %lu after warm-up",
+                    allocations, allocations - allocation_check.baseline);
+
+    pthread_cond_destroy(&pipeline.cond);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < MAX_LCD_DISPLAYS; j++)
+            cleanup_png_encoder(&pipeline.frame_buffers[i][j].png);
+    }
+}
@@ -0,0 +1,55 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Pipelined fetch, render and upload stages.
+ * @details Each stage runs in its own thread. Stages are connected by
+ * single-slot mailboxes that always hold the latest value, so a slow stage
+ * drops stale work instead of delaying fresh frames.
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+// Forward declarations
+struct Config;
+
+/**
+ * @brief Start the fetch, render and upload threads.
+ * @details The threads block all signals; the caller keeps handling them.
+ * Each tick fetches sensor data once and renders and uploads a frame per
+ * display.
+ * @param displays Per-display configurations (read-only while running)
+ * @param display_count Number of displays (1..MAX_LCD_DISPLAYS)
+ * @return 1 on success, 0 on failure
+ */
+int start_pipeline(const struct Config *displays, int display_count);
+
+/**
+ * @brief Park all stages between work items.
+ * @details Blocks until every stage has finished its current item, so the
+ * configuration can be reloaded safely (SIGHUP).
+ */
+void pause_pipeline(void);
+
+/**
+ * @brief Resume parked stages.
+ * @details Discards queued sensor data and frames from before the pause and
+ * restarts the fetch schedule.
+ * @param displays Reloaded per-display configurations
+ * @param display_count Number of displays (1..MAX_LCD_DISPLAYS)
+ */
+void resume_pipeline(const struct Config *displays, int display_count);
+
+/**
+ * @brief Stop all stages and join the threads.
+ */
+void stop_pipeline(void);
+
+#endif // PIPELINE_H
@@ -0,0 +1,254 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Frame timing statistics.
+ * @details Stages record from the fetch, render and upload threads and the
+ * summary is requested from the main thread, so one mutex guards the
+ * histograms. Recording is a few additions, cheap enough to stay always on.
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "config.h"
+#include "stats.h"
+
+// Histogram upper bounds in microseconds; the last bucket is open-ended
+#define STATS_BUCKET_COUNT 14
+static const uint64_t bucket_bounds_us[STATS_BUCKET_COUNT - 1] = {
+    500, 1000, 2000, 5000, 10000, 20000, 50000,
+    100000, 200000, 500000, 1000000, 2000000, 5000000};
+
+static const char *const stage_names[STAT_STAGE_COUNT] = {
+    "http", "parse", "render", "encode", "upload", "frame"};
+
+/** @brief Latency histogram of one stage. */
+typedef struct
+{
+    unsigned long buckets[STATS_BUCKET_COUNT];
+    unsigned long count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} StageHistogram;
+
+/** @brief All histograms plus the frame deadline counters. */
+typedef struct
+{
+    StageHistogram stages[STAT_STAGE_COUNT];
+    unsigned long frames;
+    unsigned long missed_deadlines;
+    uint64_t since_ns;
+} FrameStats;
+
+static struct
+{
+    pthread_mutex_t lock;
+    FrameStats data;
+    int interval_s;
+    uint64_t last_summary_ns;
+} stats = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+uint64_t stats_clock_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+/** @brief Histogram bucket of a duration. */
+static int bucket_index(uint64_t elapsed_ns)
+{
+    const uint64_t elapsed_us = elapsed_ns / 1000ULL;
+    int index = 0;
+    while (index < STATS_BUCKET_COUNT - 1 && elapsed_us >= bucket_bounds_us[index])
+        index++;
+    return index;
+}
+
+/** @brief Add a sample to a histogram. Caller holds the lock. */
+static void add_sample(StageHistogram *histogram, uint64_t elapsed_ns)
+{
+    histogram->buckets[bucket_index(elapsed_ns)]++;
+    histogram->count++;
+    histogram->total_ns += elapsed_ns;
+    if (elapsed_ns > histogram->max_ns)
+        histogram->max_ns = elapsed_ns;
+}
+
+/** @brief Start the statistics window on the first sample. Caller holds the lock. */
+static void start_window(uint64_t now_ns)
+{
+    if (stats.data.since_ns == 0)
+        stats.data.since_ns = now_ns;
+}
+
+void record_stage_time(stat_stage_t stage, uint64_t start_ns)
+{
+    if ((int)stage < 0 || stage >= STAT_STAGE_COUNT || start_ns == 0)
+        return;
+
+    const uint64_t now_ns = stats_clock_ns();
+    const uint64_t elapsed_ns = now_ns > start_ns ? now_ns - start_ns : 0;
+
+    pthread_mutex_lock(&stats.lock);
+    start_window(start_ns);
+    add_sample(&stats.data.stages[stage], elapsed_ns);
+    pthread_mutex_unlock(&stats.lock);
+}
+
+void record_frame_latency(uint64_t start_ns, float deadline_s)
+{
+    if (start_ns == 0)
+        return;
+
+    const uint64_t now_ns = stats_clock_ns();
+    const uint64_t elapsed_ns = now_ns > start_ns ? now_ns - start_ns : 0;
+    const uint64_t deadline_ns = (uint64_t)((double)deadline_s * 1e9);
+
+    pthread_mutex_lock(&stats.lock);
+    start_window(start_ns);
+    add_sample(&stats.data.stages[STAT_FRAME], elapsed_ns);
+    stats.data.frames++;
+    if (deadline_ns > 0 && elapsed_ns > deadline_ns)
+        stats.data.missed_deadlines++;
+    pthread_mutex_unlock(&stats.lock);
+}
+
+void set_stats_interval(int interval_s)
+{
+    pthread_mutex_lock(&stats.lock);
+    stats.interval_s = interval_s > 0 ? interval_s : 0;
+    stats.last_summary_ns = stats_clock_ns();
+    pthread_mutex_unlock(&stats.lock);
+}
+
+void log_stats_if_due(void)
+{
+    const uint64_t now_ns = stats_clock_ns();
+
+    pthread_mutex_lock(&stats.lock);
+    const int due = stats.interval_s > 0 &&
+                    now_ns - stats.last_summary_ns >=
+                        (uint64_t)stats.interval_s * 1000000000ULL;
+    if (due)
+        stats.last_summary_ns = now_ns;
+    pthread_mutex_unlock(&stats.lock);
+
+    if (due)
+        log_stats();
+}
+
+/**
+ * @brief Upper bound of the bucket holding a percentile, as text.
+ */
+static void format_percentile(const StageHistogram *histogram, double fraction,
+                              char *buf, size_t buf_size)
+{
+    const unsigned long rank =
+        (unsigned long)((double)histogram->count * fraction + 0.5);
+    unsigned long seen = 0;
+    for (int i = 0; i < STATS_BUCKET_COUNT - 1; i++)
+    {
+        seen += histogram->buckets[i];
+        if (seen >= rank && seen > 0)
+        {
+            snprintf(buf, buf_size, "<%gms", (double)bucket_bounds_us[i] / 1000.0);
+            return;
+        }
+    }
+    snprintf(buf, buf_size, ">=%gms",
+             (double)bucket_bounds_us[STATS_BUCKET_COUNT - 2] / 1000.0);
+}
+
+/**
+ * @brief Non-empty histogram buckets as "<bound:count" pairs.
+ */
+static void format_buckets(const StageHistogram *histogram, char *buf,
+                           size_t buf_size)
+{
+    size_t used = 0;
+    buf[0] = '\0';
+    for (int i = 0; i < STATS_BUCKET_COUNT && used < buf_size; i++)
+    {
+        if (histogram->buckets[i] == 0)
+            continue;
+
+        const double bound_ms =
+            (double)bucket_bounds_us[i < STATS_BUCKET_COUNT - 1
+                                         ? i
+                                         : STATS_BUCKET_COUNT - 2] /
+            1000.0;
+        const int written = snprintf(
+            buf + used, buf_size - used, "%s%s%gms:%lu", used > 0 ? " " : "",
+            i < STATS_BUCKET_COUNT - 1 ? "<" : ">=", bound_ms,
+            histogram->buckets[i]);
+        if (written < 0)
+            break;
+        used += (size_t)written;
+    }
+}
+
+void log_stats(void)
+{
+    pthread_mutex_lock(&stats.lock);
+    const FrameStats snapshot = stats.data;
+    pthread_mutex_unlock(&stats.lock);
+
+    if (snapshot.since_ns == 0)
+    {
+        log_message(LOG_STATUS, "Frame stats: no samples yet");
+        return;
+    }
+
+    const double window_s =
+        (double)(stats_clock_ns() - snapshot.since_ns) / 1e9;
+    const double missed_pct =
+        snapshot.frames > 0
+            ? 100.0 * (double)snapshot.missed_deadlines / (double)snapshot.frames
+            : 0.0;
+    log_message(LOG_STATUS,
+                "Frame stats over %.0fs: %lu frames, %lu missed deadline (%.1f%%)",
+                window_s, snapshot.frames, snapshot.missed_deadlines,
+                missed_pct);
+
+    for (int i = 0; i < STAT_STAGE_COUNT; i++)
+    {
+        const StageHistogram *histogram = &snapshot.stages[i];
+        if (histogram->count == 0)
+            continue;
+
+        char p50[16], p95[16], buckets[256];
+        format_percentile(histogram, 0.50, p50, sizeof(p50));
+        format_percentile(histogram, 0.95, p95, sizeof(p95));
+        format_buckets(histogram, buckets, sizeof(buckets));
+
+        log_message(LOG_STATUS,
+                    "  %-6s n=%lu avg=%.2fms max=%.2fms p50%s p95%s [%s]",
+                    stage_names[i], histogram->count,
+                    (double)histogram->total_ns / (double)histogram->count / 1e6,
+                    (double)histogram->max_ns / 1e6, p50, p95, buckets);
+    }
+}
+
+void reset_stats(void)
+{
+    pthread_mutex_lock(&stats.lock);
+    memset(&stats.data, 0, sizeof(stats.data));
+    pthread_mutex_unlock(&stats.lock);
+}
@@ -0,0 +1,69 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Frame timing statistics.
+ * @details Per-stage latencies on the monotonic clock, collected into
+ * fixed-bucket histograms. Frames whose sensor-to-LCD latency exceeds the
+ * refresh interval count as missed deadlines. The summary is logged on
+ * SIGUSR1 and, with --stats, periodically.
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <stdint.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+/** @brief Timed stages of a tick. */
+typedef enum
+{
+    STAT_SENSOR_HTTP,  // /status request
+    STAT_SENSOR_PARSE, // /status or stream event JSON
+    STAT_RENDER,       // Cairo frame and pixel hash
+    STAT_ENCODE,       // PNG encode
+    STAT_UPLOAD,       // LCD image upload
+    STAT_FRAME,        // Sensor poll start to finished upload
+    STAT_STAGE_COUNT
+} stat_stage_t;
+
+/** @brief Current monotonic time in nanoseconds, the start of a timed stage. */
+uint64_t stats_clock_ns(void);
+
+/**
+ * @brief Record the time elapsed since start_ns for a stage.
+ * @details Thread-safe; stages run in different pipeline threads.
+ */
+void record_stage_time(stat_stage_t stage, uint64_t start_ns);
+
+/**
+ * @brief Record the latency of an uploaded frame.
+ * @param start_ns Monotonic time the frame's sensor poll started (0 = unknown)
+ * @param deadline_s Refresh interval the frame had to meet
+ */
+void record_frame_latency(uint64_t start_ns, float deadline_s);
+
+/**
+ * @brief Enable the periodic summary (--stats).
+ * @param interval_s Seconds between summaries, 0 to disable
+ */
+void set_stats_interval(int interval_s);
+
+/** @brief Log the summary if the periodic interval elapsed. */
+void log_stats_if_due(void);
+
+/** @brief Log counts, averages, maxima and histogram of every stage. */
+void log_stats(void);
+
+/** @brief Clear all histograms and counters. */
+void reset_stats(void);
+
+#endif // STATS_H
@@ -0,0 +1,137 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief config.json change watch.
+ * @details Used from the main thread only. Events for other files in the
+ * plugin directory (credentials.json, images) are drained and ignored.
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+#define _XOPEN_SOURCE 600
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../srv/cc_conf.h"
+#include "config.h"
+#include "watch.h"
+
+// Writes finished in place, or a new file renamed over the old one
+#define CONFIG_WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
+
+static struct
+{
+    int fd;
+    int wd;
+    char name[CONFIG_MAX_PATH_LEN];
+} config_watch = {.fd = -1, .wd = -1};
+
+int start_config_watch(const char *config_path)
+{
+    if (!config_path || config_watch.fd >= 0)
+        return 0;
+
+    char resolved[PATH_MAX];
+    if (!realpath(config_path, resolved))
+    {
+        log_message(LOG_WARNING, "Config watch: cannot resolve %s: %s",
+                    config_path, strerror(errno));
+        return 0;
+    }
+
+    char *slash = strrchr(resolved, '/');
+    if (!slash || slash[1] == '\0')
+        return 0;
+    cc_safe_strcpy(config_watch.name, sizeof(config_watch.name), slash + 1);
+    if (slash == resolved)
+        slash[1] = '\0';
+    else
+        *slash = '\0';
+
+    config_watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (config_watch.fd < 0)
+    {
+        log_message(LOG_WARNING, "Config watch: inotify unavailable: %s",
+                    strerror(errno));
+        return 0;
+    }
+
+    config_watch.wd = inotify_add_watch(config_watch.fd, resolved,
+                                        CONFIG_WATCH_EVENTS);
+    if (config_watch.wd < 0)
+    {
+        log_message(LOG_WARNING, "Config watch: cannot watch %s: %s", resolved,
+                    strerror(errno));
+        stop_config_watch();
+        return 0;
+    }
+
+    log_message(LOG_INFO, "Watching %s/%s for changes", resolved,
+                config_watch.name);
+    return 1;
+}
+
+int get_config_watch_fd(void)
+{
+    return config_watch.fd;
+}
+
+int config_watch_changed(void)
+{
+    if (config_watch.fd < 0)
+        return 0;
+
+    // Aligned for struct inotify_event
+    union
+    {
+        struct inotify_event event;
+        char bytes[4096];
+    } buffer;
+
+    int changed = 0;
+    for (;;)
+    {
+        const ssize_t length = read(config_watch.fd, buffer.bytes,
+                                    sizeof(buffer.bytes));
+        if (length <= 0)
+            break; // EAGAIN: drained
+
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const struct inotify_event *event =
+                (const struct inotify_event *)(buffer.bytes + offset);
+            if (event->wd == config_watch.wd && event->len > 0 &&
+                (event->mask & CONFIG_WATCH_EVENTS) &&
+                strcmp(event->name, config_watch.name) == 0)
+                changed = 1;
+            offset += (ssize_t)(sizeof(struct inotify_event) + event->len);
+        }
+    }
+
+    return changed;
+}
+
+void stop_config_watch(void)
+{
+    if (config_watch.fd >= 0)
+        close(config_watch.fd);
+    config_watch.fd = -1;
+    config_watch.wd = -1;
+    config_watch.name[0] = '\0';
+}
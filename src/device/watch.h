@@ -0,0 +1,39 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief config.json change watch.
+ * @details inotify on the directory of config.json, so files replaced by
+ * rename (editors, CoolerControl) are seen as well as in-place writes. The
+ * main loop waits on the descriptor next to its signals.
+ */
+
+#ifndef WATCH_H
+#define WATCH_H
+
+/**
+ * @brief Start watching a config file.
+ * @param config_path Existing config.json (symlinks are resolved)
+ * @return 1 on success, 0 if inotify is unavailable (reload via SIGHUP only)
+ */
+int start_config_watch(const char *config_path);
+
+/** @brief Descriptor to wait on for changes, or -1 if not watching. */
+int get_config_watch_fd(void);
+
+/**
+ * @brief Drain pending events.
+ * @return 1 if the watched file was written or replaced, 0 otherwise
+ */
+int config_watch_changed(void);
+
+/** @brief Stop watching and close the descriptor. */
+void stop_config_watch(void);
+
+#endif // WATCH_H
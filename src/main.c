@@ -19,12 +19,14 @@
 // cppcheck-suppress-begin missingIncludeSystem
 #include <dirent.h>
 #include <errno.h>
+#include <pthread.h>
 #include <pwd.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/select.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -36,6 +38,10 @@
 
 // Include project headers
 #include "device/config.h"
+#include "device/logger.h"
+#include "device/pipeline.h"
+#include "device/stats.h"
+#include "device/watch.h"
 #include "mods/display.h"
 #include "srv/cc_conf.h"
 #include "srv/cc_main.h"
@@ -47,14 +53,52 @@
 #define CC4_MODE_LOCK "/etc/coolercontrol/plugins/coolerdash/.cc4-mode"
 #define GH_UPDATE_URL "https://api.github.com/repos/damachine/coolerdash/releases/latest"
 
+// Seconds between frame timing summaries with --stats
+#define STATS_SUMMARY_INTERVAL 300
+
+// GitHub release check, run in the background after the first frame
+#define UPDATE_CHECK_TIMEOUT_MS 5000L
+
+// Seconds between device cache retries after a degraded reload
+#define DEGRADED_RETRY_INTERVAL 10
+
 static volatile sig_atomic_t running = 1;
 static volatile sig_atomic_t reload_config = 0;
+static volatile sig_atomic_t dump_stats = 0;
 
 static const char *s_config_path = NULL;
 static char s_display_mode_override[16] = {0};
 
+// --preview: render one frame to a file and exit (see run_preview())
+static struct
+{
+    const char *output_path;
+    const char *fragment_path;
+    const char *fixture_dir;
+} s_preview;
+
+// Per-LCD configs derived from the loaded config (see load_display_configs())
+static Config s_displays[MAX_LCD_DISPLAYS];
+static int s_display_count = 0;
+
 int verbose_logging = 0;
 
+/**
+ * @brief Startup work that does not gate the first frame.
+ * @details Runs in its own thread while the pipeline starts; joined before a
+ * reload or shutdown touches the session.
+ */
+static struct
+{
+    pthread_t thread;
+    int started;
+    const char *shutdown_image_path;
+    const char *version;
+} s_startup_tasks;
+
+// Sensor probe of initialize_device_info(), rendered as the first frame
+static monitor_sensor_data_t s_startup_sensors;
+
 const Config *g_config_ptr = NULL;
 
 /** @brief Resolve configured shutdown image path with silent fallback to shutdown.png. */
@@ -209,89 +253,61 @@ static void send_update_notification(const char *current, const char *latest)
     struct passwd *pw = getpwuid(target_uid);
     if (!pw)
         return;
+    const gid_t target_gid = pw->pw_gid;
+
+    /* Everything the child needs is built here: between fork() and exec
+     * the child of this multithreaded process may only make
+     * async-signal-safe calls (no malloc, stdio or setenv) */
+    char dbus_env[160], xdg_env[96], home_env[CONFIG_MAX_PATH_LEN + 8];
+    char display_env[160];
+    snprintf(dbus_env, sizeof(dbus_env),
+             "DBUS_SESSION_BUS_ADDRESS=unix:path=/run/user/%u/bus",
+             (unsigned)target_uid);
+    snprintf(xdg_env, sizeof(xdg_env), "XDG_RUNTIME_DIR=/run/user/%u",
+             (unsigned)target_uid);
+    n = snprintf(home_env, sizeof(home_env), "HOME=%s", pw->pw_dir);
+    if (n < 0 || (size_t)n >= sizeof(home_env))
+        return;
 
-    pid_t pid = fork();
+    /* Detect display server: Wayland socket or X11 fallback */
+    char wayland_path[128];
+    snprintf(wayland_path, sizeof(wayland_path), "/run/user/%u/wayland-0",
+             (unsigned)target_uid);
+    cc_safe_strcpy(display_env, sizeof(display_env),
+                   access(wayland_path, F_OK) == 0 ? "WAYLAND_DISPLAY=wayland-0"
+                                                   : "DISPLAY=:0");
+
+    char *const envp[] = {dbus_env, xdg_env, home_env, display_env,
+                          "PATH=/usr/local/bin:/usr/bin:/bin", NULL};
+
+    /* The shell waits for the notification action and opens the release */
+    static const char script[] =
+        "action=$(notify-send --wait -t 10000 -i coolerdash -a CoolerDash "
+        "-A open=Download 'CoolerDash Update' \"$1\") && "
+        "[ \"$action\" = open ] && [ -x /usr/bin/xdg-open ] && "
+        "exec xdg-open \"$2\"";
+    char *const argv[] = {"sh", "-c", (char *)script, "sh", body, url, NULL};
+
+    /* Double fork: the intermediate child exits at once and is reaped here,
+     * init reaps the notifier, and no thread changes SIGCHLD handling */
+    const pid_t pid = fork();
     if (pid < 0)
         return;
 
     if (pid == 0)
     {
-        /* Child: set D-Bus environment and drop to desktop user */
-        char dbus_addr[128];
-        snprintf(dbus_addr, sizeof(dbus_addr),
-                 "unix:path=/run/user/%u/bus", (unsigned)target_uid);
-        setenv("DBUS_SESSION_BUS_ADDRESS", dbus_addr, 1);
-
-        char xdg_dir[64];
-        snprintf(xdg_dir, sizeof(xdg_dir),
-                 "/run/user/%u", (unsigned)target_uid);
-        setenv("XDG_RUNTIME_DIR", xdg_dir, 1);
-        setenv("HOME", pw->pw_dir, 1);
-
-        /* Detect display server: Wayland socket or X11 fallback */
-        char wayland_path[128];
-        snprintf(wayland_path, sizeof(wayland_path),
-                 "/run/user/%u/wayland-0", (unsigned)target_uid);
-        if (access(wayland_path, F_OK) == 0)
-        {
-            setenv("WAYLAND_DISPLAY", "wayland-0", 1);
-        }
-        else
-        {
-            setenv("DISPLAY", ":0", 1);
-        }
-
-        /* Drop privileges to desktop user */
-        if (setgid(pw->pw_gid) != 0 || setuid(target_uid) != 0)
-            _exit(1);
+        if (fork() != 0)
+            _exit(0);
 
-        /* Fork grandchild for notify-send with action pipe */
-        int pfd[2];
-        if (pipe(pfd) != 0)
+        /* Notifier: drop to the desktop user and exec */
+        if (setgid(target_gid) != 0 || setuid(target_uid) != 0)
             _exit(1);
-
-        pid_t np = fork();
-        if (np < 0)
-            _exit(1);
-
-        if (np == 0)
-        {
-            /* Grandchild: exec notify-send, stdout → pipe */
-            close(pfd[0]);
-            dup2(pfd[1], STDOUT_FILENO);
-            close(pfd[1]);
-            execlp("notify-send", "notify-send",
-                   "--wait",
-                   "-t", "10000",
-                   "-i", "coolerdash",
-                   "-a", "CoolerDash",
-                   "-A", "open=Download",
-                   "CoolerDash Update", body,
-                   (char *)NULL);
-            _exit(1);
-        }
-
-        /* Child: read action from notify-send stdout */
-        close(pfd[1]);
-        char action[32] = {0};
-        ssize_t rd = read(pfd[0], action, sizeof(action) - 1);
-        close(pfd[0]);
-        waitpid(np, NULL, 0);
-
-        if (rd > 0)
-        {
-            action[strcspn(action, "\n")] = '\0';
-            if (strcmp(action, "open") == 0 &&
-                access("/usr/bin/xdg-open", X_OK) == 0)
-            {
-                execlp("xdg-open", "xdg-open", url, (char *)NULL);
-            }
-        }
-        _exit(0);
+        execve("/bin/sh", argv, envp);
+        _exit(1);
     }
 
-    /* Parent: don't block — reap child asynchronously */
-    signal(SIGCHLD, SIG_IGN);
+    while (waitpid(pid, NULL, 0) < 0 && errno == EINTR)
+        ;
 }
 
 /** @brief Query GitHub Releases API and log if a newer version exists. */
@@ -300,14 +316,15 @@ static void check_for_update(const char *current_version)
     if (!current_version || current_version[0] == '\0')
         return;
 
-    CURL *curl = curl_easy_init();
+    // Pooled handle without signals, aborted by stop_pipeline()
+    CURL *curl = cc_create_easy_handle();
     if (!curl)
         return;
 
     http_response buf = {0};
     if (!cc_init_response_buffer(&buf, 2048))
     {
-        curl_easy_cleanup(curl);
+        cc_release_easy_handle(curl);
         return;
     }
 
@@ -323,13 +340,11 @@ static void check_for_update(const char *current_version)
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, (curl_write_callback)write_callback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buf);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
-    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 3L);
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = cc_perform_external_transfer(curl, UPDATE_CHECK_TIMEOUT_MS);
     long http_code = 0;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
 
@@ -364,9 +379,9 @@ static void check_for_update(const char *current_version)
     }
 
     cc_cleanup_response_buffer(&buf);
+    cc_release_easy_handle(curl);
     if (headers)
         curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
 }
 
 /**
@@ -404,7 +419,16 @@ static void show_help(const char *program_name)
     printf(
         "  --dual            Force dual display mode (CPU+GPU simultaneously)\n");
     printf("  --circle          Force circle mode (alternating CPU/GPU every 2.5 "
-           "seconds)\n\n");
+           "seconds)\n");
+    printf("  --stats           Log frame timing statistics every %d seconds "
+           "(also on SIGUSR1)\n",
+           STATS_SUMMARY_INTERVAL);
+    printf("  --preview FILE    Render one frame to FILE and exit (no LCD "
+           "upload)\n");
+    printf("  --fragment FILE   With --preview: partial config.json applied on "
+           "top\n");
+    printf("  --fixture DIR     With --preview: sensors from DIR/status.json "
+           "(+devices.json)\n\n");
     printf("DISPLAY MODES:\n");
     printf(
         "  dual              Default mode - shows CPU and GPU simultaneously\n");
@@ -425,7 +449,10 @@ static void show_help(const char *program_name)
            "logging\n",
            program_name);
     printf("  %s /custom/config.json            # Start with custom "
-           "configuration\n\n",
+           "configuration\n",
+           program_name);
+    printf("  %s --preview /tmp/p.png --fragment layout.json  # Preview a "
+           "layout change\n\n",
            program_name);
     printf("FILES:\n");
     printf("  /usr/libexec/coolerdash/coolerdash            # Main executable\n");
@@ -532,7 +559,14 @@ static void handle_reload_signal(int signum)
     reload_config = 1;
 }
 
-/** @brief Install signal handlers for SIGTERM/SIGINT/SIGQUIT/SIGHUP. */
+/** @brief SIGUSR1 handler — requests a frame timing summary. */
+static void handle_stats_signal(int signum)
+{
+    (void)signum;
+    dump_stats = 1;
+}
+
+/** @brief Install signal handlers for SIGTERM/SIGINT/SIGQUIT/SIGHUP/SIGUSR1. */
 static void setup_enhanced_signal_handlers(void)
 {
     struct sigaction sa;
@@ -576,6 +610,19 @@ static void setup_enhanced_signal_handlers(void)
                     strerror(errno));
     }
 
+    // Install SIGUSR1 handler for the frame timing summary
+    struct sigaction sa_stats;
+    memset(&sa_stats, 0, sizeof(sa_stats));
+    sa_stats.sa_handler = handle_stats_signal;
+    sigemptyset(&sa_stats.sa_mask);
+    sa_stats.sa_flags = SA_RESTART;
+
+    if (sigaction(SIGUSR1, &sa_stats, NULL) == -1)
+    {
+        log_message(LOG_WARNING, "Failed to install SIGUSR1 handler: %s",
+                    strerror(errno));
+    }
+
     sigemptyset(&block_mask);
     sigaddset(&block_mask, SIGPIPE);
 
@@ -585,15 +632,136 @@ static void setup_enhanced_signal_handlers(void)
     }
 }
 
-/** @brief Re-read config.json on SIGHUP; re-init session and device cache. */
-static void reload_daemon_config(Config *config)
+/** @brief Apply the CLI display mode override to a set of configs. */
+static void apply_mode_override(Config *configs, int count)
+{
+    if (s_display_mode_override[0] == '\0')
+        return;
+
+    for (int i = 0; i < count; i++)
+        cc_safe_strcpy(configs[i].display_mode, sizeof(configs[i].display_mode),
+                       s_display_mode_override);
+}
+
+/** @brief Derive the per-display configs and apply the CLI mode override. */
+static void load_displays(const Config *config)
+{
+    s_display_count = load_display_configs(config, s_config_path, s_displays,
+                                           MAX_LCD_DISPLAYS);
+    apply_mode_override(s_displays, s_display_count);
+}
+
+/** @brief Apply device dimensions and build the layout plan of every display. */
+static void prepare_displays(void)
+{
+    for (int i = 0; i < s_display_count; i++)
+    {
+        update_config_from_device(&s_displays[i]);
+        build_layout_plan(&s_displays[i]);
+    }
+}
+
+/**
+ * @brief Register the shutdown image of every display with CoolerControl.
+ * @details CC stores it internally and applies it automatically when CC
+ * shuts down.
+ */
+static void register_shutdown_images(const char *shutdown_image_path)
+{
+    for (int i = 0; shutdown_image_path && i < s_display_count; i++)
+    {
+        char shutdown_uid[CC_UID_SIZE] = {0};
+        char shutdown_device_name[CONFIG_MAX_STRING_LEN] = {0};
+        int shutdown_w = 0, shutdown_h = 0;
+        if (get_cached_lcd_device_data(&s_displays[i], shutdown_uid,
+                                       sizeof(shutdown_uid), shutdown_device_name,
+                                       sizeof(shutdown_device_name),
+                                       &shutdown_w, &shutdown_h) &&
+            shutdown_uid[0] != '\0')
+        {
+            if (strcmp(shutdown_image_path, DEFAULT_SHUTDOWN_IMAGE_PATH) != 0)
+            {
+                log_message(LOG_INFO,
+                            "Registering custom shutdown image with CoolerControl: %s",
+                            shutdown_image_path);
+            }
+
+            register_lcd_shutdown_image_with_cc(&s_displays[i],
+                                                shutdown_image_path,
+                                                shutdown_uid);
+        }
+        else
+        {
+            log_message(LOG_WARNING,
+                        "Skipping shutdown image registration because no LCD device UID was cached");
+        }
+    }
+}
+
+/** @brief Startup thread: shutdown image registration, then update check. */
+static void *run_startup_tasks(void *arg)
+{
+    (void)arg;
+    register_shutdown_images(s_startup_tasks.shutdown_image_path);
+    check_for_update(s_startup_tasks.version);
+    return NULL;
+}
+
+/**
+ * @brief Run the startup work in the background.
+ * @details Falls back to running it inline if the thread cannot be created.
+ */
+static void start_startup_tasks(const Config *config)
 {
-    log_message(LOG_STATUS, "SIGHUP received — reloading configuration...");
+    s_startup_tasks.shutdown_image_path = resolve_shutdown_image_path(config);
+    s_startup_tasks.version = read_version_from_file();
+
+    // Signals stay with the main thread
+    sigset_t all_signals, old_mask;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &old_mask);
+    const int err = pthread_create(&s_startup_tasks.thread, NULL,
+                                   run_startup_tasks, NULL);
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+
+    if (err != 0)
+    {
+        log_message(LOG_WARNING, "Failed to start startup thread: %s",
+                    strerror(err));
+        run_startup_tasks(NULL);
+        return;
+    }
+    s_startup_tasks.started = 1;
+}
 
+/**
+ * @brief Stop the startup thread (before reload and shutdown).
+ * @details Its requests are aborted first, so a reload right after startup
+ * does not wait for the shutdown image upload and the update check.
+ */
+static void wait_for_startup_tasks(void)
+{
+    if (!s_startup_tasks.started)
+        return;
+    cc_abort_thread_transfers(s_startup_tasks.thread);
+    pthread_join(s_startup_tasks.thread, NULL);
+    cc_clear_thread_abort();
+    s_startup_tasks.started = 0;
+}
+
+/**
+ * @brief Re-read config.json; re-init session and device cache.
+ * @details The full reload of SIGHUP, which also rediscovers the LCDs.
+ * Called with the pipeline parked.
+ */
+static void reload_daemon_config(Config *config)
+{
     cleanup_sensor_curl_handle();
+    reset_sensor_state();
     reset_coolercontrol_session();
     reset_device_cache();
     reset_display_state();
+    reset_stats();
 
     load_plugin_config(config, s_config_path);
 
@@ -606,27 +774,176 @@ static void reload_daemon_config(Config *config)
     }
 
     // 4. Re-initialize CoolerControl session with potentially new token/address
+    int reloaded = 0;
     if (!init_coolercontrol_session(config))
     {
         log_message(LOG_ERROR,
                     "Config reload: session re-init failed — continuing with degraded state");
-        return;
     }
-
     // 5. Re-populate device cache
-    if (!init_device_cache(config))
+    else if (!init_device_cache(config))
     {
         log_message(LOG_ERROR,
                     "Config reload: device cache re-init failed — continuing with degraded state");
-        return;
     }
+    else
+    {
+        reloaded = 1;
+    }
+
+    // Plans are rebuilt in degraded state too: built lazily, they would be
+    // written by the render stage while the fetch stage reads them
+    load_displays(config);
+    prepare_displays();
+
+    if (reloaded)
+        log_message(LOG_STATUS, "Configuration reloaded successfully");
+}
 
-    update_config_from_device(config);
+/**
+ * @brief Retry the session and device cache after a degraded reload.
+ * @details Called with the pipeline parked, so the device caches are only
+ * written while no stage reads them. On success the displays are prepared as
+ * in a full reload.
+ * @return 1 once the device cache is initialized
+ */
+static int retry_degraded_reload(Config *config)
+{
+    if (!is_session_initialized() && !init_coolercontrol_session(config))
+        return 0;
+    if (!init_device_cache(config))
+        return 0;
+
+    reset_sensor_state();
+    reset_display_state();
+    load_displays(config);
+    prepare_displays();
 
     log_message(LOG_STATUS, "Configuration reloaded successfully");
+    return 1;
+}
+
+/** @brief Names of changed config sections, comma separated. */
+static void format_config_sections(unsigned int changed, char *buf,
+                                   size_t buf_size)
+{
+    static const struct
+    {
+        config_section_t section;
+        const char *name;
+    } names[] = {
+        {CONFIG_SECTION_DAEMON, "daemon"},   {CONFIG_SECTION_PATHS, "paths"},
+        {CONFIG_SECTION_DETECTION, "detection"},
+        {CONFIG_SECTION_DISPLAY, "display"}, {CONFIG_SECTION_SLOTS, "slots"},
+        {CONFIG_SECTION_LAYOUT, "layout"},   {CONFIG_SECTION_COLORS, "colors"},
+        {CONFIG_SECTION_FONT, "font"},       {CONFIG_SECTION_SENSORS, "sensors"}};
+
+    size_t used = 0;
+    buf[0] = '\0';
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]) && used < buf_size; i++)
+    {
+        if (!(changed & (unsigned int)names[i].section))
+            continue;
+        const int written = snprintf(buf + used, buf_size - used, "%s%s",
+                                     used > 0 ? ", " : "", names[i].name);
+        if (written < 0)
+            break;
+        used += (size_t)written;
+    }
+}
+
+/**
+ * @brief Reload config.json after a change seen by the config watch.
+ * @details The new configs are loaded into scratch copies while the pipeline
+ * keeps running and compared section by section with the running ones, so a
+ * write that changes nothing (including the daemon's own normalisation of
+ * config.json) costs one parse. Only the state of changed sections is reset:
+ * a daemon change reconnects the HTTP session, a color change redraws the
+ * static layers, and the device cache is kept. Detection changes take the
+ * full SIGHUP reload to rediscover the LCDs.
+ */
+static void reload_changed_config(Config *config)
+{
+    // Too large for the stack of a loop iteration
+    static Config new_config;
+    static Config new_displays[MAX_LCD_DISPLAYS];
+
+    if (!load_plugin_config(&new_config, s_config_path))
+    {
+        log_message(LOG_WARNING,
+                    "config.json changed but could not be loaded — keeping running configuration");
+        return;
+    }
+    apply_mode_override(&new_config, 1);
+
+    unsigned int changed = diff_config_sections(config, &new_config);
+    if (changed & CONFIG_SECTION_DETECTION)
+    {
+        log_message(LOG_STATUS,
+                    "LCD detection settings changed — reloading configuration...");
+        pause_pipeline();
+        wait_for_startup_tasks();
+        reload_daemon_config(config);
+        resume_pipeline(s_displays, s_display_count);
+        return;
+    }
+
+    // Same device cache, so device dimensions resolve as for the running displays
+    const int new_count = load_display_configs(&new_config, s_config_path,
+                                               new_displays, MAX_LCD_DISPLAYS);
+    apply_mode_override(new_displays, new_count);
+    for (int i = 0; i < new_count; i++)
+        update_config_from_device(&new_displays[i]);
+
+    // An added display brings slots the sensor filter and slot table lack
+    if (new_count != s_display_count)
+        changed |= CONFIG_SECTION_DISPLAY | CONFIG_SECTION_SLOTS;
+    for (int i = 0; i < new_count && i < s_display_count; i++)
+        changed |= diff_config_sections(&s_displays[i], &new_displays[i]);
+
+    if (changed == 0)
+    {
+        log_message(LOG_INFO, "config.json changed without effect on the running configuration");
+        return;
+    }
+
+    char sections[128];
+    format_config_sections(changed, sections, sizeof(sections));
+    log_message(LOG_STATUS, "config.json changed — reloading: %s", sections);
+
+    pause_pipeline();
+    // The startup thread reads the session and the display configs
+    wait_for_startup_tasks();
+
+    if (changed & CONFIG_SECTION_DAEMON)
+    {
+        cleanup_sensor_curl_handle();
+        reset_sensor_state();
+        reset_coolercontrol_session();
+    }
+    else if (changed & CONFIG_SECTION_SLOTS)
+    {
+        reset_sensor_state();
+    }
+
+    *config = new_config;
+    for (int i = 0; i < new_count; i++)
+        s_displays[i] = new_displays[i];
+    s_display_count = new_count;
+
+    if ((changed & CONFIG_SECTION_DAEMON) && !init_coolercontrol_session(config))
+        log_message(LOG_ERROR,
+                    "Config reload: session re-init failed — continuing with degraded state");
+
+    invalidate_display_state(changed);
+    for (int i = 0; i < s_display_count; i++)
+        build_layout_plan(&s_displays[i]);
+    reset_stats();
+
+    resume_pipeline(s_displays, s_display_count);
 }
 
-/** @brief Main daemon loop: renders display on interval, handles SIGHUP. */
+/** @brief Main daemon loop: runs the render pipeline, handles SIGHUP and config changes. */
 static int run_daemon(Config *config)
 {
     if (!config)
@@ -635,56 +952,108 @@ static int run_daemon(Config *config)
         return -1;
     }
 
-    long interval_sec = (long)config->display_refresh_interval;
-    long interval_nsec =
-        (long)((config->display_refresh_interval - interval_sec) * 1000000000);
+    // Block handled signals so they are only delivered inside pselect()
+    sigset_t handled_mask, old_mask;
+    sigemptyset(&handled_mask);
+    sigaddset(&handled_mask, SIGTERM);
+    sigaddset(&handled_mask, SIGINT);
+    sigaddset(&handled_mask, SIGQUIT);
+    sigaddset(&handled_mask, SIGHUP);
+    sigaddset(&handled_mask, SIGUSR1);
+    if (pthread_sigmask(SIG_BLOCK, &handled_mask, &old_mask) != 0)
+    {
+        log_message(LOG_ERROR, "Failed to block daemon signals");
+        return -1;
+    }
 
-    struct timespec interval = {.tv_sec = interval_sec,
-                                .tv_nsec = interval_nsec};
+    sigset_t suspend_mask = old_mask;
+    sigdelset(&suspend_mask, SIGTERM);
+    sigdelset(&suspend_mask, SIGINT);
+    sigdelset(&suspend_mask, SIGQUIT);
+    sigdelset(&suspend_mask, SIGHUP);
+    sigdelset(&suspend_mask, SIGUSR1);
 
-    struct timespec next_time;
-    if (clock_gettime(CLOCK_MONOTONIC, &next_time) != 0)
+    if (!start_pipeline(s_displays, s_display_count))
     {
-        log_message(LOG_ERROR, "Failed to get current time: %s", strerror(errno));
+        pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
         return -1;
     }
 
+    start_config_watch(find_plugin_config_path(s_config_path));
+    int config_changed = 0;
+
     while (running)
     {
         if (reload_config)
         {
             reload_config = 0;
+            config_changed = 0;
+            log_message(LOG_STATUS, "SIGHUP received — reloading configuration...");
+            pause_pipeline();
+            wait_for_startup_tasks();
             reload_daemon_config(config);
-
-            interval_sec = (long)config->display_refresh_interval;
-            interval_nsec = (long)((config->display_refresh_interval -
-                                    interval_sec) *
-                                   1000000000);
-            interval.tv_sec = interval_sec;
-            interval.tv_nsec = interval_nsec;
+            resume_pipeline(s_displays, s_display_count);
+            continue;
         }
 
-        next_time.tv_sec += interval.tv_sec;
-        next_time.tv_nsec += interval.tv_nsec;
-        if (next_time.tv_nsec >= 1000000000L)
+        if (config_changed)
         {
-            next_time.tv_sec++;
-            next_time.tv_nsec -= 1000000000L;
+            config_changed = 0;
+            reload_changed_config(config);
+            continue;
         }
 
-        draw_display_image(config);
+        if (dump_stats)
+        {
+            dump_stats = 0;
+            log_stats();
+            continue;
+        }
 
-        int sleep_result =
-            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_time, NULL);
-        if (sleep_result != 0 && sleep_result != EINTR)
+        // Sleeps until a signal or a config.json change (no fd: signals only);
+        // a degraded reload also wakes up to retry the device cache
+        const int watch_fd = get_config_watch_fd();
+        fd_set watch_fds;
+        FD_ZERO(&watch_fds);
+        if (watch_fd >= 0)
+            FD_SET(watch_fd, &watch_fds);
+        const int degraded = !is_device_cache_initialized();
+        const struct timespec retry_delay = {DEGRADED_RETRY_INTERVAL, 0};
+        const int ready = pselect(watch_fd + 1, &watch_fds, NULL, NULL,
+                                  degraded ? &retry_delay : NULL, &suspend_mask);
+        if (ready > 0 && watch_fd >= 0 && FD_ISSET(watch_fd, &watch_fds))
+            config_changed = config_watch_changed();
+        else if (ready == 0 && degraded)
         {
-            log_message(LOG_WARNING, "Sleep interrupted: %s", strerror(sleep_result));
+            pause_pipeline();
+            wait_for_startup_tasks();
+            retry_degraded_reload(config);
+            resume_pipeline(s_displays, s_display_count);
         }
     }
 
+    stop_config_watch();
+
+    // Aborts transfers in flight, so the startup thread ends promptly
+    stop_pipeline();
+    wait_for_startup_tasks();
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+
     return 0;
 }
 
+/** @brief Value of an option that takes an argument; exits if it is missing. */
+static const char *get_option_value(int argc, char **argv, int *index)
+{
+    if (*index + 1 >= argc)
+    {
+        fprintf(stderr, "Error: Option '%s' requires an argument.\n",
+                argv[*index]);
+        exit(EXIT_FAILURE);
+    }
+    return argv[++*index];
+}
+
 /** @brief Parse CLI args; returns config path. */
 static const char *parse_arguments(int argc, char **argv,
                                    char *display_mode_override)
@@ -712,6 +1081,22 @@ static const char *parse_arguments(int argc, char **argv,
         {
             cc_safe_strcpy(display_mode_override, 16, "circle");
         }
+        else if (strcmp(argv[i], "--stats") == 0)
+        {
+            set_stats_interval(STATS_SUMMARY_INTERVAL);
+        }
+        else if (strcmp(argv[i], "--preview") == 0)
+        {
+            s_preview.output_path = get_option_value(argc, argv, &i);
+        }
+        else if (strcmp(argv[i], "--fragment") == 0)
+        {
+            s_preview.fragment_path = get_option_value(argc, argv, &i);
+        }
+        else if (strcmp(argv[i], "--fixture") == 0)
+        {
+            s_preview.fixture_dir = get_option_value(argc, argv, &i);
+        }
         else if (argv[i][0] != '-')
         {
             config_path = argv[i];
@@ -805,51 +1190,66 @@ static int initialize_coolercontrol_services(const Config *config)
     return 0;
 }
 
-/** @brief Fetch device info, validate sensors, log system state. */
-static void initialize_device_info(Config *config)
+/**
+ * @brief Fetch device info, validate sensors, log system state.
+ * @details The sensor probe is kept in s_startup_sensors for the first frame.
+ * @return 1 if the probe returned sensor data, 0 otherwise
+ */
+static int initialize_device_info(void)
 {
-    char device_uid[128] = {0};
-    monitor_sensor_data_t temp_data = {0};
-    char device_name[CONFIG_MAX_STRING_LEN] = {0};
-    int api_screen_width = 0, api_screen_height = 0;
+    int devices_found = 0;
 
-    if (!get_cached_lcd_device_data(config, device_uid, sizeof(device_uid),
-                                    device_name, sizeof(device_name),
-                                    &api_screen_width, &api_screen_height))
+    for (int i = 0; i < s_display_count; i++)
     {
-        log_message(LOG_ERROR, "Could not retrieve device information");
-        return;
-    }
+        Config *display = &s_displays[i];
+        char device_uid[128] = {0};
+        char device_name[CONFIG_MAX_STRING_LEN] = {0};
+        int api_screen_width = 0, api_screen_height = 0;
+
+        if (!get_cached_lcd_device_data(display, device_uid, sizeof(device_uid),
+                                        device_name, sizeof(device_name),
+                                        &api_screen_width, &api_screen_height))
+        {
+            log_message(LOG_WARNING, "No LCD device found for display %d", i + 1);
+            continue;
+        }
 
-    update_config_from_device(config);
+        update_config_from_device(display);
+        devices_found++;
 
-    const char *uid_display =
-        (device_uid[0] != '\0') ? device_uid : "Unknown device UID";
-    const char *name_display =
-        (device_name[0] != '\0') ? device_name : "Unknown device";
+        const char *uid_display =
+            (device_uid[0] != '\0') ? device_uid : "Unknown device UID";
+        const char *name_display =
+            (device_name[0] != '\0') ? device_name : "Unknown device";
 
-    log_message(LOG_STATUS, "Device: %s [%s]", name_display, uid_display);
+        log_message(LOG_STATUS, "Device: %s [%s]", name_display, uid_display);
+        show_system_diagnostics(display, api_screen_width, api_screen_height);
+    }
 
-    if (get_sensor_monitor_data(config, &temp_data))
+    if (devices_found == 0)
     {
-        if (temp_data.sensor_count > 0)
-        {
-            log_message(LOG_STATUS, "Sensor values successfully detected (%d sensors)",
-                        temp_data.sensor_count);
-        }
-        else
-        {
-            log_message(LOG_WARNING,
-                        "Sensor detection issues - no sensor values available");
-        }
+        log_message(LOG_ERROR, "Could not retrieve device information");
+        return 0;
     }
-    else
+
+    if (!get_sensor_monitor_data(s_displays, s_display_count, &s_startup_sensors))
     {
         log_message(LOG_WARNING,
                     "Sensor detection issues - check CoolerControl connection");
+        return 0;
     }
 
-    show_system_diagnostics(config, api_screen_width, api_screen_height);
+    if (s_startup_sensors.sensor_count > 0)
+    {
+        log_message(LOG_STATUS, "Sensor values successfully detected (%d sensors)",
+                    s_startup_sensors.sensor_count);
+    }
+    else
+    {
+        log_message(LOG_WARNING,
+                    "Sensor detection issues - no sensor values available");
+    }
+    return 1;
 }
 
 /** @brief Cleanup CURL handles and log shutdown. */
@@ -857,12 +1257,163 @@ static void perform_cleanup(const Config *config)
 {
     (void)config;
     log_message(LOG_INFO, "Daemon shutdown initiated");
-    cleanup_coolercontrol_session();
+    cc_abort_transfers();
+    wait_for_startup_tasks();
+    // Handles attached to the shared connection pool go first
     cleanup_sensor_curl_handle();
+    cleanup_coolercontrol_session();
+    release_frame_canvases();
     running = 0;
     log_message(LOG_INFO, "CoolerDash shutdown complete");
 }
 
+// ============================================================================
+// Preview Mode
+// ============================================================================
+
+/**
+ * @brief Read a fixture file into a NUL-terminated heap buffer.
+ * @return Buffer (caller frees), or NULL
+ */
+static char *read_fixture_file(const char *dir, const char *name, size_t *size)
+{
+    char path[CONFIG_MAX_PATH_LEN];
+    const int written = snprintf(path, sizeof(path), "%s/%s", dir, name);
+    if (written < 0 || written >= (int)sizeof(path))
+        return NULL;
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+        return NULL;
+
+    char *data = NULL;
+    long length = -1;
+    if (fseek(fp, 0, SEEK_END) == 0)
+        length = ftell(fp);
+    if (length > 0 && fseek(fp, 0, SEEK_SET) == 0)
+    {
+        data = malloc((size_t)length + 1);
+        if (data && fread(data, 1, (size_t)length, fp) == (size_t)length)
+        {
+            data[length] = '\0';
+            *size = (size_t)length;
+        }
+        else
+        {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(fp);
+    return data;
+}
+
+/**
+ * @brief Load preview sensors (and devices) from a recorded fixture.
+ * @details status.json is required; devices.json is optional and only
+ * provides the device name and panel size.
+ */
+static int load_preview_fixture(const Config *config, monitor_sensor_data_t *data)
+{
+    size_t size = 0;
+    char *devices = read_fixture_file(s_preview.fixture_dir, "devices.json", &size);
+    if (devices)
+    {
+        if (!init_device_cache_from_json(config, devices, size))
+            log_message(LOG_WARNING, "No LCD device in %s/devices.json",
+                        s_preview.fixture_dir);
+        free(devices);
+    }
+
+    char *status = read_fixture_file(s_preview.fixture_dir, "status.json", &size);
+    if (!status)
+    {
+        log_message(LOG_ERROR, "Cannot read %s/status.json", s_preview.fixture_dir);
+        return 0;
+    }
+
+    const int success = parse_sensor_status(config, 1, status, size, data);
+    free(status);
+    return success;
+}
+
+/**
+ * @brief Fetch preview sensors from coolercontrold on a session of its own.
+ */
+static int fetch_preview_sensors(const Config *config, monitor_sensor_data_t *data)
+{
+    if (!init_coolercontrol_session(config))
+    {
+        log_message(LOG_ERROR, "CoolerControl session initialization failed");
+        return 0;
+    }
+
+    if (!init_device_cache(config))
+        log_message(LOG_WARNING, "No LCD device found, using config dimensions");
+
+    return get_sensor_monitor_data(config, 1, data);
+}
+
+/**
+ * @brief Render one frame of the first display to a PNG file and exit.
+ * @details Safe to run beside the daemon: no PID or lock files, no signal
+ * handlers and no LCD upload. Panel dimensions set in the config or fragment
+ * win over the detected device, so layouts can be previewed for other panel
+ * sizes.
+ */
+static int run_preview(const char *config_path)
+{
+    static Config config;
+    static monitor_sensor_data_t data;
+    const uint64_t start_ns = stats_clock_ns();
+
+    if (!load_preview_config(&config, config_path, s_preview.fragment_path))
+        return EXIT_FAILURE;
+
+    if (s_display_mode_override[0] != '\0')
+        cc_safe_strcpy(config.display_mode, sizeof(config.display_mode),
+                       s_display_mode_override);
+
+    const int fixed_size = config.display_width > 0 && config.display_height > 0;
+    int success = s_preview.fixture_dir ? load_preview_fixture(&config, &data)
+                                        : fetch_preview_sensors(&config, &data);
+
+    size_t png_size = 0;
+    if (success)
+    {
+        if (!fixed_size)
+            update_config_from_device(&config);
+        if (config.display_width == 0 || config.display_height == 0)
+        {
+            config.display_width = 240;
+            config.display_height = 240;
+        }
+
+        build_layout_plan(&config);
+        success = render_preview_image(&config, &data, s_preview.output_path,
+                                       &png_size);
+    }
+
+    if (!s_preview.fixture_dir)
+    {
+        cleanup_sensor_curl_handle();
+        cleanup_coolercontrol_session();
+    }
+    release_frame_canvases();
+
+    if (!success)
+    {
+        log_message(LOG_ERROR, "Preview rendering failed");
+        return EXIT_FAILURE;
+    }
+
+    log_message(LOG_STATUS, "Preview written to %s (%ux%u %s, %zu bytes, %.1f ms)",
+                s_preview.output_path, config.display_width,
+                config.display_height, config.display_mode, png_size,
+                (double)(stats_clock_ns() - start_ns) / 1e6);
+    return EXIT_SUCCESS;
+}
+
 /** @brief Daemon entry point. */
 int main(int argc, char **argv)
 {
@@ -873,6 +1424,19 @@ int main(int argc, char **argv)
     cc_safe_strcpy(s_display_mode_override, sizeof(s_display_mode_override),
                    display_mode_override);
 
+    if (s_preview.output_path)
+        return run_preview(config_path);
+    if (s_preview.fragment_path || s_preview.fixture_dir)
+    {
+        fprintf(stderr, "Error: --fragment and --fixture require --preview.\n");
+        return EXIT_FAILURE;
+    }
+
+    // Pipeline threads must not wait on stdout or the journal; every exit
+    // path writes out the queued lines
+    if (start_logger())
+        atexit(stop_logger);
+
     log_message(LOG_STATUS, "CoolerDash v%s starting up...",
                 read_version_from_file());
 
@@ -915,48 +1479,20 @@ int main(int argc, char **argv)
     }
 
     log_message(LOG_STATUS, "CoolerDash initializing device cache...\n");
-    initialize_device_info(&config);
-
-    // Register shutdown image with CoolerControl at startup.
-    // CC stores it internally and applies it automatically when CC shuts down.
-    {
-        const char *shutdown_image_path = resolve_shutdown_image_path(&config);
-        if (shutdown_image_path)
-        {
-            char shutdown_uid[CC_UID_SIZE] = {0};
-            char shutdown_device_name[CONFIG_MAX_STRING_LEN] = {0};
-            int shutdown_w = 0, shutdown_h = 0;
-            if (get_cached_lcd_device_data(&config, shutdown_uid, sizeof(shutdown_uid),
-                                           shutdown_device_name,
-                                           sizeof(shutdown_device_name),
-                                           &shutdown_w, &shutdown_h) &&
-                shutdown_uid[0] != '\0')
-            {
-                if (strcmp(shutdown_image_path, DEFAULT_SHUTDOWN_IMAGE_PATH) != 0)
-                {
-                    log_message(LOG_INFO,
-                                "Registering custom shutdown image with CoolerControl: %s",
-                                shutdown_image_path);
-                }
-
-                register_lcd_shutdown_image_with_cc(&config,
-                                                    shutdown_image_path,
-                                                    shutdown_uid);
-            }
-            else
-            {
-                log_message(LOG_WARNING,
-                            "Skipping shutdown image registration because no LCD device UID was cached");
-            }
-        }
-    }
-
-    check_for_update(read_version_from_file());
+    load_displays(&config);
+    const int have_sensors = initialize_device_info();
+    for (int i = 0; i < s_display_count; i++)
+        build_layout_plan(&s_displays[i]);
 
     // Render initial image immediately so the PNG exists on disk
-    // before CC applies saved LCD settings (avoids startup race condition)
+    // before CC applies saved LCD settings (avoids startup race condition).
+    // The startup probe is the first frame's data, no second /status fetch.
     log_message(LOG_INFO, "Rendering initial display image...");
-    draw_display_image(&config);
+    draw_display_image(s_displays, s_display_count,
+                       have_sensors ? &s_startup_sensors : NULL);
+
+    // Shutdown image registration and update check do not gate the LCD
+    start_startup_tasks(&config);
 
     log_message(LOG_STATUS, "Starting daemon");
     int result = run_daemon(&config);
@@ -24,16 +24,86 @@
 // Include project headers
 #include "../device/config.h"
 #include "../srv/cc_conf.h"
-#include "../srv/cc_main.h"
 #include "../srv/cc_sensor.h"
 #include "display.h"
+#include "history.h"
+#include "text.h"
 #include "circle.h"
 
 /**
- * @brief Global state for sensor alternation (slot-based cycling).
+ * @brief Fitted label lane metrics, reused by the extra info lines.
  */
-static int current_slot_index = 0; // 0=slot1, 1=slot2, 2=slot3
-static time_t last_switch_time = 0;
+typedef struct
+{
+    double font_size;
+    cairo_font_extents_t font_ext;
+} CircleLabel;
+
+/**
+ * @brief Circle mode slot geometry derived from the layout plan.
+ */
+typedef struct
+{
+    unsigned int generation; /**< Layout plan generation, 0 = not computed */
+    int has_label;
+    char label[64];
+    int bar_x;
+    int bar_y;
+    int bar_width;
+    int bar_height;
+    double value_box_y;
+    double value_box_height;
+    double value_lane_x;
+    double value_lane_width;
+    double label_box_y;
+    double label_box_height;
+    double label_font_size; /**< Label size fitted to the bar width */
+    cairo_font_extents_t label_font_ext;
+} CircleSlotLayout;
+
+/** @brief Regions of the circle frame that are redrawn independently. */
+enum
+{
+    CIRCLE_REGION_BAR,
+    CIRCLE_REGION_VALUE,
+    CIRCLE_REGION_EXTRA,
+    CIRCLE_REGION_COUNT
+};
+
+/**
+ * @brief Last frame drawn on a display's canvas (dirty rectangle redraw).
+ */
+typedef struct
+{
+    int valid;
+    uint64_t layer_key;                    // Static layer the frame was composed on
+    uint64_t keys[CIRCLE_REGION_COUNT];    // Content drawn per region
+    DirtyRect rects[CIRCLE_REGION_COUNT];  // Region bounds
+    DirtyRect value_block;                 // Rendered value block
+} CircleFrame;
+
+/**
+ * @brief Per-display circle mode state.
+ * @details Slot cycling, cached slot geometry, and the retained static layer
+ * with the label metrics it was drawn with.
+ */
+typedef struct
+{
+    int current_slot_index; // 0=slot1, 1=slot2, 2=slot3
+    time_t last_switch_time;
+    CircleSlotLayout slot_layouts[3];
+    StaticLayer layer;
+    CircleLabel label;
+    CircleFrame frame;
+} CircleState;
+
+static CircleState circle_states[MAX_LCD_DISPLAYS] = {0};
+
+/** @brief Get the circle mode state of a display. */
+static CircleState *get_circle_state(const struct Config *config)
+{
+    return &circle_states[get_display_state_index(config)];
+}
 
 static int ascii_tolower(int c)
 {
@@ -64,12 +134,14 @@ static int contains_ignore_case(const char *haystack, const char *needle)
 
 /**
  * @brief Resets circle mode state for config reload (SIGHUP).
- * @details Resets slot cycling to the first sensor and clears the switch timer.
+ * @details Resets slot cycling to the first sensor, clears the switch timer
+ * and drops cached geometry and the static layer.
  */
 void reset_circle_state(void)
 {
-    current_slot_index = 0;
-    last_switch_time = 0;
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        release_static_layer(&circle_states[i].layer);
+    memset(circle_states, 0, sizeof(circle_states));
 }
 
 /**
@@ -90,7 +162,7 @@ static const sensor_entry_t *find_liquid_pump_rpm(
     {
         if (data->sensors[i].category != SENSOR_CATEGORY_RPM)
             continue;
-        if (strcmp(data->sensors[i].device_type, "Liquidctl") != 0)
+        if (strcmp(data->sensors[i].device->type, "Liquidctl") != 0)
             continue;
 
         /* Prefer sensor with "pump" in the name. */
@@ -396,85 +468,196 @@ static int find_next_active_slot(const struct Config *config, int start_index)
     return -1; // No active slots
 }
 
+/** @brief Seconds each slot is shown. */
+static double get_switch_interval(const struct Config *config)
+{
+    return (config && config->circle_switch_interval > 0)
+               ? (double)config->circle_switch_interval
+               : 5.0; // Fallback: 5 seconds
+}
+
 /**
  * @brief Check if sensor should switch based on configured interval.
  */
 static void update_sensor_mode(const struct Config *config)
 {
+    CircleState *state = get_circle_state(config);
     time_t current_time = time(NULL);
 
-    if (last_switch_time == 0)
+    if (state->last_switch_time == 0)
     {
         // Initialize to first active slot
-        current_slot_index = find_next_active_slot(config, 0);
-        if (current_slot_index < 0)
-            current_slot_index = 0; // Fallback
-        last_switch_time = current_time;
+        state->current_slot_index = find_next_active_slot(config, 0);
+        if (state->current_slot_index < 0)
+            state->current_slot_index = 0; // Fallback
+        state->last_switch_time = current_time;
         return;
     }
 
     // Check if configured interval has elapsed
-    const double interval = (config && config->circle_switch_interval > 0)
-                                ? (double)config->circle_switch_interval
-                                : 5.0; // Fallback: 5 seconds
+    const double interval = get_switch_interval(config);
 
-    if (difftime(current_time, last_switch_time) >= interval)
+    if (difftime(current_time, state->last_switch_time) >= interval)
     {
         // Find next active slot
-        int next_slot = find_next_active_slot(config, (current_slot_index + 1) % 3);
+        int next_slot =
+            find_next_active_slot(config, (state->current_slot_index + 1) % 3);
         if (next_slot >= 0)
-            current_slot_index = next_slot;
-        last_switch_time = current_time;
+            state->current_slot_index = next_slot;
+        state->last_switch_time = current_time;
 
         // Verbose logging only
         if (verbose_logging)
         {
-            const char *slot_value = get_slot_value_by_index(config, current_slot_index);
+            const char *slot_value =
+                get_slot_value_by_index(config, state->current_slot_index);
             const char *label = get_slot_label(config, NULL, slot_value);
             log_message(LOG_INFO,
                         "Circle mode: switched to %s display (slot: %s, interval: %.0fs)",
                         label ? label : "unknown",
-                        get_slot_name_by_index(current_slot_index),
+                        get_slot_name_by_index(state->current_slot_index),
                         interval);
         }
     }
 }
 
 /**
- * @brief Draw single sensor display based on current slot.
- * @param cr Cairo context
- * @param config Configuration
- * @param params Scaling parameters
- * @param data Sensor data
- * @param slot_value Current slot sensor value ("cpu", "gpu", "liquid")
+ * @brief Draw everything that does not depend on sensor values.
+ * @details Background, bar background and border, and the label lane. The
+ * label font is fitted here; label holds the starting size on entry and the
+ * fitted size and extents on return.
  */
-static void draw_single_sensor(cairo_t *cr, const struct Config *config,
-                               const ScalingParams *params,
-                               const monitor_sensor_data_t *data,
-                               const char *slot_value)
+static void draw_static_content(cairo_t *cr, const struct Config *config,
+                                const LayoutPlan *plan,
+                                const char *label_text, int bar_x, int bar_y,
+                                int effective_bar_width, int bar_height,
+                                double label_box_y, double label_box_height,
+                                CircleLabel *label)
 {
-    if (!cr || !config || !params || !data || !slot_value)
-        return;
+    const ScalingParams *params = &plan->params;
 
-    // Skip if slot is not active
-    if (!slot_is_active(slot_value))
-        return;
+    paint_display_background(cr, config);
 
-    // Get temperature and label for current slot
-    const float temp_value = get_slot_temperature(data, slot_value);
-    const char *label_text = get_slot_label(config, data, slot_value);
-    const float max_temp = get_slot_max_scale(config, slot_value);
+    const double bar_alpha = config->layout_bar_opacity;
+
+    // Bar background
+    set_cairo_color_alpha(cr, &config->layout_bar_color_background, bar_alpha);
+    draw_rounded_rectangle_path(cr, bar_x, bar_y, effective_bar_width, bar_height,
+                                params->corner_radius);
+    cairo_fill(cr);
+
+    // Bar border (only if enabled and thickness > 0)
+    if (config->layout_bar_border_enabled && config->layout_bar_border > 0.0f)
+    {
+        set_cairo_color_alpha(cr, &config->layout_bar_color_border, bar_alpha);
+        draw_rounded_rectangle_path(cr, bar_x, bar_y, effective_bar_width, bar_height,
+                                    params->corner_radius);
+        cairo_set_line_width(cr, plan->bar_border_width);
+        cairo_stroke(cr);
+    }
+
+    // Draw label (CPU, GPU, or LIQ) in a dedicated bottom lane anchored to the bar.
+    if (label_text)
+    {
+        const Color *label_color = &config->font_color_label;
+        cairo_text_extents_t label_text_ext = {0};
+        double label_safe_x = bar_x;
+        double label_safe_width = effective_bar_width;
+        const double left_margin_factor =
+            (config->layout_label_margin_left > 0)
+                ? (config->layout_label_margin_left / 100.0)
+                : 0.01;
+
+        calculate_text_lane_bounds(config, params, label_box_y,
+                                   label_box_height, 0, bar_x,
+                                   effective_bar_width, &label_safe_x,
+                                   &label_safe_width);
+
+        const double label_left_padding = label_safe_width * left_margin_factor;
+        const double label_inner_padding_y =
+            fmax(2.0, scale_value_avg(params, 4.0));
+        const double available_label_width =
+            fmax(24.0, label_safe_width - label_left_padding);
+        const double available_label_height =
+            fmax(12.0, label_box_height - (2.0 * label_inner_padding_y));
+        const double min_label_font_size =
+            (config->font_size_labels > 0.0f)
+                ? fmax(12.0, scale_value_avg(params,
+                                             (double)config->font_size_labels) *
+                                 0.70)
+                : fmax(12.0, scale_value_avg(params, 12.0));
+
+        select_text_font(cr, config, TEXT_WEIGHT_NORMAL);
 
+        while (1)
+        {
+            cairo_set_font_size(cr, label->font_size);
+            measure_font(cr, &label->font_ext);
+            measure_text(cr, label_text, &label_text_ext);
+
+            if ((fmax(label_text_ext.x_advance, label_text_ext.width) <=
+                     available_label_width &&
+                 (label->font_ext.ascent + label->font_ext.descent) <=
+                     available_label_height) ||
+                label->font_size <= min_label_font_size)
+                break;
+
+            label->font_size *= 0.94;
+            if (label->font_size < min_label_font_size)
+                label->font_size = min_label_font_size;
+        }
+
+        set_cairo_color(cr, label_color);
+
+        double label_x = label_safe_x + (label_safe_width * left_margin_factor);
+        double final_label_y =
+            label_box_y + label_inner_padding_y + label->font_ext.ascent;
+
+        // Apply user-defined offsets using the uniform layout scale.
+        label_x += plan->label_offset_x;
+        final_label_y += plan->label_offset_y;
+
+        cairo_move_to(cr, label_x, final_label_y);
+        cairo_show_text(cr, label_text);
+    }
+}
+
+/**
+ * @brief Get the cached geometry for the current slot.
+ * @details Recomputed only when the layout plan is rebuilt or the slot label
+ * changes. The first label fit needs a cairo context for text measurement.
+ */
+static const CircleSlotLayout *get_circle_slot_layout(cairo_t *cr,
+                                                      const struct Config *config,
+                                                      const LayoutPlan *plan,
+                                                      const char *slot_value,
+                                                      const char *label_text)
+{
+    CircleState *state = get_circle_state(config);
+    const int current_slot_index = state->current_slot_index;
+    CircleSlotLayout *layout = &state->slot_layouts[current_slot_index];
+
+    if (layout->generation == plan->generation &&
+        layout->has_label == (label_text != NULL) &&
+        (!label_text || strcmp(layout->label, label_text) == 0))
+        return layout;
+
+    memset(layout, 0, sizeof(*layout));
+    layout->generation = plan->generation;
+    layout->has_label = (label_text != NULL);
+    if (label_text)
+        SAFE_STRCPY(layout->label, label_text);
+
+    const ScalingParams *params = &plan->params;
     const int effective_bar_width = params->safe_bar_width;
-    const int bar_height = get_scaled_slot_bar_height(
-        config, params, get_slot_name_by_index(current_slot_index));
+    const int bar_height = plan->slot_bar_height[current_slot_index];
     const int bar_x = (int)lround(params->safe_content_margin);
 
-    const double region_gap = get_effective_label_spacing(config, params);
+    const double region_gap = plan->label_spacing;
     const double label_padding = fmax(2.0, scale_value_avg(params, 4.0));
 
     double label_band_height = 0.0;
-    double label_font_size = get_preferred_label_font_size(config, params);
+    double label_font_size = plan->label_font_size;
     cairo_font_extents_t label_font_ext = {0};
     cairo_text_extents_t label_text_ext = {0};
 
@@ -494,13 +677,12 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
                                  0.70)
                 : fmax(12.0, scale_value_avg(params, 12.0));
 
-        cairo_select_font_face(cr, config->font_face, CAIRO_FONT_SLANT_NORMAL,
-                               CAIRO_FONT_WEIGHT_NORMAL);
+        select_text_font(cr, config, TEXT_WEIGHT_NORMAL);
         while (1)
         {
             cairo_set_font_size(cr, label_font_size);
-            cairo_font_extents(cr, &label_font_ext);
-            cairo_text_extents(cr, label_text, &label_text_ext);
+            measure_font(cr, &label_font_ext);
+            measure_text(cr, label_text, &label_text_ext);
             if (fmax(label_text_ext.x_advance, label_text_ext.width) <=
                     available_label_width ||
                 label_font_size <= min_label_font_size)
@@ -525,18 +707,37 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
     const double value_bar_gap = region_gap * 0.05;
 
     const double value_box_y = params->margin_top;
-    const SensorConfig *sc_gap = get_sensor_config(config, slot_value);
-    const double gap_above = (sc_gap && sc_gap->value_to_bar_gap > 0.0f)
-                                 ? available_height * (sc_gap->value_to_bar_gap / 100.0)
+    SlotStyle scratch;
+    const SlotStyle *style = get_slot_style(config, slot_value, &scratch);
+    const double gap_above = (style->value_to_bar_gap > 0.0f)
+                                 ? available_height * (style->value_to_bar_gap / 100.0)
                                  : value_bar_gap;
-    const double gap_below = (sc_gap && sc_gap->label_to_bar_gap > 0.0f)
-                                 ? available_height * (sc_gap->label_to_bar_gap / 100.0)
+    const double gap_below = (style->label_to_bar_gap > 0.0f)
+                                 ? available_height * (style->label_to_bar_gap / 100.0)
                                  : region_gap;
     const double value_box_height = fmax(0.0, bar_y - gap_above - params->margin_top);
     const double label_box_y = bar_y + bar_height + gap_below;
     const double label_box_height =
         fmax(0.0, config->display_height - params->margin_bottom - label_box_y);
 
+    layout->bar_x = bar_x;
+    layout->bar_y = bar_y;
+    layout->bar_width = effective_bar_width;
+    layout->bar_height = bar_height;
+    layout->value_box_y = value_box_y;
+    layout->value_box_height = value_box_height;
+    layout->value_lane_x = bar_x;
+    layout->value_lane_width = effective_bar_width;
+    if (value_box_height > 0.0)
+        calculate_text_lane_bounds(config, params, value_box_y,
+                                   value_box_height, 0, bar_x,
+                                   effective_bar_width, &layout->value_lane_x,
+                                   &layout->value_lane_width);
+    layout->label_box_y = label_box_y;
+    layout->label_box_height = label_box_height;
+    layout->label_font_size = label_font_size;
+    layout->label_font_ext = label_font_ext;
+
     if (verbose_logging)
     {
         log_message(
@@ -549,33 +750,209 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
             label_box_height, effective_bar_width);
     }
 
-    const Color *value_color = &config->font_color_temp;
+    return layout;
+}
 
-    // Draw temperature bar (centered reference point)
-    const double bar_alpha = config->layout_bar_opacity;
+/**
+ * @brief Hash the text content of a frame region.
+ */
+static uint64_t hash_region_texts(const char *first, const char *second)
+{
+    uint64_t key = STATIC_LAYER_KEY_SEED;
+    key = hash_layer_key_string(key, first);
+    key = hash_layer_key_string(key, second);
+    return key;
+}
 
-    // Bar background
-    set_cairo_color_alpha(cr, &config->layout_bar_color_background, bar_alpha);
-    draw_rounded_rectangle_path(cr, bar_x, bar_y, effective_bar_width, bar_height,
-                                params->corner_radius);
-    cairo_fill(cr);
+/**
+ * @brief Draw single sensor display based on current slot.
+ * @details On a retained canvas over the same static layer only the regions
+ * whose content changed (bar, value lane, extra info lane) are cleared and
+ * redrawn; a frame without changes draws nothing.
+ * @param cr Cairo context
+ * @param config Configuration
+ * @param plan Layout plan
+ * @param data Sensor data
+ * @param slot_value Current slot sensor value ("cpu", "gpu", "liquid")
+ * @param retained 1 if the canvas holds this renderer's previous frame
+ */
+static void draw_single_sensor(cairo_t *cr, const struct Config *config,
+                               const LayoutPlan *plan,
+                               const monitor_sensor_data_t *data,
+                               const char *slot_value, int retained)
+{
+    if (!cr || !config || !plan || !data || !slot_value)
+        return;
 
-    // Bar border (only if enabled and thickness > 0)
-    if (config->layout_bar_border_enabled && config->layout_bar_border > 0.0f)
+    // Skip if slot is not active
+    if (!slot_is_active(slot_value))
+        return;
+
+    // Get temperature and label for current slot
+    const float temp_value = get_slot_temperature(data, slot_value);
+    const char *label_text = get_slot_label(config, data, slot_value);
+    const float max_temp = get_slot_max_scale(config, slot_value);
+
+    // Geometry comes from the per-slot cache derived from the layout plan
+    const ScalingParams *params = &plan->params;
+    const CircleSlotLayout *layout =
+        get_circle_slot_layout(cr, config, plan, slot_value, label_text);
+    const int effective_bar_width = layout->bar_width;
+    const int bar_height = layout->bar_height;
+    const int bar_x = layout->bar_x;
+    const int bar_y = layout->bar_y;
+    const double value_box_y = layout->value_box_y;
+    const double value_box_height = layout->value_box_height;
+    const double label_box_y = layout->label_box_y;
+    const double label_box_height = layout->label_box_height;
+    double label_font_size = layout->label_font_size;
+    cairo_font_extents_t label_font_ext = layout->label_font_ext;
+
+    const Color *value_color = &config->font_color_temp;
+
+    // Static layer: background, bar background/border and label lane
+    CircleState *state = get_circle_state(config);
+    uint64_t key = STATIC_LAYER_KEY_SEED;
+    key = hash_layer_key(key, params, sizeof(*params));
+    key = hash_layer_key(key, &state->current_slot_index,
+                         sizeof(state->current_slot_index));
+    key = hash_layer_key_string(key, slot_value);
+    key = hash_layer_key_string(key, label_text);
+    const int bar_geometry[4] = {bar_x, bar_y, effective_bar_width, bar_height};
+    key = hash_layer_key(key, bar_geometry, sizeof(bar_geometry));
+    const double label_geometry[3] = {label_box_y, label_box_height,
+                                      label_font_size};
+    key = hash_layer_key(key, label_geometry, sizeof(label_geometry));
+
+    cairo_t *layer_cr = begin_static_layer(config, &state->layer, key);
+    if (layer_cr)
     {
-        set_cairo_color_alpha(cr, &config->layout_bar_color_border, bar_alpha);
-        draw_rounded_rectangle_path(cr, bar_x, bar_y, effective_bar_width, bar_height,
-                                    params->corner_radius);
-        cairo_set_line_width(cr, get_scaled_bar_border_width(config, params));
-        cairo_stroke(cr);
+        state->label.font_size = label_font_size;
+        state->label.font_ext = label_font_ext;
+        draw_static_content(layer_cr, config, plan, label_text, bar_x, bar_y,
+                            effective_bar_width, bar_height, label_box_y,
+                            label_box_height, &state->label);
+        end_static_layer(&state->layer, layer_cr);
     }
 
-    // Bar fill (temperature-based)
+    // Per-frame content of each region
     const int fill_width = calculate_temp_fill_width(temp_value, effective_bar_width, max_temp);
+    const Color bar_color = get_slot_bar_color(config, slot_value, temp_value);
+
+    char value_buf[32];
+    format_slot_value_text(value_buf, sizeof(value_buf), data, slot_value,
+                           temp_value);
+    char duty_buf[16] = {0};
+    if (strcmp(slot_value, "cpu") == 0 || strcmp(slot_value, "gpu") == 0)
+    {
+        const sensor_entry_t *duty_s = find_channel_sensor_for_slot(
+            data, slot_value, SENSOR_CATEGORY_DUTY);
+        if (duty_s)
+            snprintf(duty_buf, sizeof(duty_buf), "%.0f", duty_s->value);
+    }
+
+    char extra_buf[64] = {0};
+    char line2_buf[64] = {0};
+    int has_extra_line = 0;
+    int has_rpm_line = 0;
+    if (config->circle_show_extra_info)
+    {
+        has_extra_line =
+            get_extra_info_text(data, slot_value, extra_buf, sizeof(extra_buf));
+        has_rpm_line =
+            get_extra_info_line2(data, slot_value, line2_buf, sizeof(line2_buf));
+    }
 
+    CircleFrame next = {0};
+    next.keys[CIRCLE_REGION_BAR] = hash_layer_key(
+        STATIC_LAYER_KEY_SEED, &fill_width, sizeof(fill_width));
+    next.keys[CIRCLE_REGION_BAR] = hash_layer_key(
+        next.keys[CIRCLE_REGION_BAR], &bar_color, sizeof(bar_color));
+    const SlotHistory *history = get_slot_history(config, slot_value);
+    if (history)
+        next.keys[CIRCLE_REGION_BAR] =
+            hash_layer_key(next.keys[CIRCLE_REGION_BAR], &history->next_seq,
+                           sizeof(history->next_seq));
+    next.keys[CIRCLE_REGION_VALUE] = hash_region_texts(value_buf, duty_buf);
+    next.keys[CIRCLE_REGION_EXTRA] = hash_region_texts(extra_buf, line2_buf);
+
+    // Value block placement, so overflowing glyphs are cleared as well
+    SlotValueLayout value_layout = {0};
+    if (value_box_height > 0.0)
+    {
+        select_text_font(cr, config, TEXT_WEIGHT_BOLD);
+        layout_and_render_slot_value(cr, data, config, params, slot_value,
+                                     temp_value, layout->value_lane_x,
+                                     value_box_y, layout->value_lane_width,
+                                     value_box_height, 0, 0, &value_layout);
+        if (value_layout.active)
+            next.value_block = make_dirty_rect(
+                value_layout.block_left, value_layout.block_top,
+                value_layout.block_right, value_layout.block_bottom, 2.0);
+    }
+
+    // Border strokes straddle the bar edge; one extra pixel covers AA
+    next.rects[CIRCLE_REGION_BAR] = make_dirty_rect(
+        bar_x, bar_y, bar_x + effective_bar_width, bar_y + bar_height,
+        plan->bar_border_width / 2.0 + 1.0);
+    next.rects[CIRCLE_REGION_VALUE] = make_dirty_rect(
+        0.0, value_box_y, config->display_width,
+        value_box_y + value_box_height, 2.0);
+    if (config->circle_show_extra_info)
+        next.rects[CIRCLE_REGION_EXTRA] = make_dirty_rect(
+            0.0, label_box_y, config->display_width, config->display_height,
+            0.0);
+
+    // Partial redraw needs the previous pixels over the same static layer
+    CircleFrame *frame = &state->frame;
+    const int partial = retained && frame->valid && state->layer.surface &&
+                        frame->layer_key == state->layer.key;
+    if (partial)
+    {
+        DirtyRect dirty[CIRCLE_REGION_COUNT + 2];
+        int dirty_count = 0;
+        for (int i = 0; i < CIRCLE_REGION_COUNT; i++)
+        {
+            if (next.keys[i] != frame->keys[i])
+                dirty[dirty_count++] = next.rects[i];
+        }
+        if (dirty_count == 0)
+            return;
+
+        // Value glyphs may overflow their lane at the minimum font size
+        if (next.keys[CIRCLE_REGION_VALUE] != frame->keys[CIRCLE_REGION_VALUE])
+        {
+            dirty[dirty_count++] = frame->value_block;
+            dirty[dirty_count++] = next.value_block;
+        }
+
+        cairo_save(cr);
+        clip_dirty_rects(cr, dirty, dirty_count);
+    }
+    else if (retained)
+    {
+        clear_frame_canvas(cr);
+    }
+
+    const int layered = paint_static_layer(cr, &state->layer);
+    if (!layered)
+    {
+        state->label.font_size = label_font_size;
+        state->label.font_ext = label_font_ext;
+        draw_static_content(cr, config, plan, label_text, bar_x, bar_y,
+                            effective_bar_width, bar_height, label_box_y,
+                            label_box_height, &state->label);
+    }
+
+    // Extra info is placed relative to the fitted label lane
+    label_font_size = state->label.font_size;
+    label_font_ext = state->label.font_ext;
+
+    const double bar_alpha = config->layout_bar_opacity;
+
+    // Bar fill (temperature-based)
     if (fill_width > 0)
     {
-        Color bar_color = get_slot_bar_color(config, slot_value, temp_value);
         set_cairo_color_alpha(cr, &bar_color, bar_alpha);
 
         cairo_save(cr);
@@ -587,211 +964,124 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
         cairo_restore(cr);
     }
 
-    cairo_select_font_face(cr, config->font_face, CAIRO_FONT_SLANT_NORMAL,
-                           CAIRO_FONT_WEIGHT_BOLD);
+    draw_slot_sparkline(cr, config, slot_value, bar_x, bar_y,
+                        effective_bar_width, bar_height,
+                        params->corner_radius);
+
+    select_text_font(cr, config, TEXT_WEIGHT_BOLD);
     set_cairo_color(cr, value_color);
-    SlotValueLayout value_layout = {0};
     if (value_box_height > 0.0)
     {
-        double safe_x = bar_x;
-        double safe_width = effective_bar_width;
-        calculate_text_lane_bounds(config, params, value_box_y,
-                                   value_box_height, 0, bar_x,
-                                   effective_bar_width, &safe_x,
-                                   &safe_width);
+        const double safe_x = layout->value_lane_x;
+        const double safe_width = layout->value_lane_width;
         layout_and_render_slot_value(cr, data, config, params, slot_value,
                                      temp_value, safe_x, value_box_y,
                                      safe_width, value_box_height, 0,
                                      1, &value_layout);
 
         /* Duty % rendered left-aligned at half temp font size */
-        if (value_layout.active &&
-            (strcmp(slot_value, "cpu") == 0 ||
-             strcmp(slot_value, "gpu") == 0))
+        if (value_layout.active && duty_buf[0] != '\0')
         {
-            const sensor_entry_t *duty_s = find_channel_sensor_for_slot(
-                data, slot_value, SENSOR_CATEGORY_DUTY);
-            if (duty_s)
+            double duty_font = value_layout.font_size * 0.5;
+            double pct_font = duty_font / 2.05;
+            cairo_font_extents_t duty_fext = {0};
+            cairo_text_extents_t duty_text_ext = {0};
+            cairo_text_extents_t pct_ext = {0};
+
+            select_text_font(cr, config, TEXT_WEIGHT_BOLD);
+            cairo_set_font_size(cr, duty_font);
+            measure_font(cr, &duty_fext);
+            measure_text(cr, duty_buf, &duty_text_ext);
+
+            cairo_set_font_size(cr, pct_font);
+            measure_text(cr, "%", &pct_ext);
+            cairo_set_font_size(cr, duty_font);
+
+            const double pct_spacing = fmax(1.0, scale_value_avg(params, 1.0));
+            double duty_number_width =
+                fmax(duty_text_ext.x_advance, duty_text_ext.width);
+            double duty_total_width = duty_number_width + pct_spacing +
+                                      fmax(pct_ext.x_advance, pct_ext.width);
+
+            /* Position: left margin, vertically centered with temp */
+            const double left_margin_factor =
+                (config->layout_label_margin_left > 0)
+                    ? (config->layout_label_margin_left / 100.0)
+                    : 0.01;
+            double duty_x = safe_x +
+                            (safe_width * left_margin_factor);
+            double duty_y = value_layout.baseline_y;
+
+            const double overlap_padding =
+                fmax(1.0, scale_value_avg(params, 2.0));
+            double duty_available_width =
+                value_layout.block_left - duty_x - overlap_padding;
+            if (duty_available_width <= 0.0)
+            {
+                duty_x = safe_x;
+                duty_available_width =
+                    value_layout.block_left - duty_x - overlap_padding;
+            }
+
+            const double min_duty_font =
+                fmax(8.0, value_layout.font_size * 0.32);
+            while (duty_total_width > duty_available_width &&
+                   duty_font > min_duty_font)
             {
-                char duty_buf[16];
-                snprintf(duty_buf, sizeof(duty_buf), "%.0f",
-                         duty_s->value);
-
-                double duty_font = value_layout.font_size * 0.5;
-                double pct_font = duty_font / 2.05;
-                cairo_font_extents_t duty_fext = {0};
-                cairo_text_extents_t duty_text_ext = {0};
-                cairo_text_extents_t pct_ext = {0};
-
-                cairo_select_font_face(cr, config->font_face,
-                                       CAIRO_FONT_SLANT_NORMAL,
-                                       CAIRO_FONT_WEIGHT_BOLD);
+                duty_font *= 0.90;
+                if (duty_font < min_duty_font)
+                    duty_font = min_duty_font;
+
+                pct_font = duty_font / 2.05;
                 cairo_set_font_size(cr, duty_font);
-                cairo_font_extents(cr, &duty_fext);
-                cairo_text_extents(cr, duty_buf, &duty_text_ext);
+                measure_font(cr, &duty_fext);
+                measure_text(cr, duty_buf, &duty_text_ext);
 
                 cairo_set_font_size(cr, pct_font);
-                cairo_text_extents(cr, "%", &pct_ext);
+                measure_text(cr, "%", &pct_ext);
                 cairo_set_font_size(cr, duty_font);
 
-                const double pct_spacing = fmax(1.0, scale_value_avg(params, 1.0));
-                double duty_number_width =
+                duty_number_width =
                     fmax(duty_text_ext.x_advance, duty_text_ext.width);
-                double duty_total_width = duty_number_width + pct_spacing +
-                                          fmax(pct_ext.x_advance, pct_ext.width);
-
-                /* Position: left margin, vertically centered with temp */
-                const double left_margin_factor =
-                    (config->layout_label_margin_left > 0)
-                        ? (config->layout_label_margin_left / 100.0)
-                        : 0.01;
-                double duty_x = safe_x +
-                                (safe_width * left_margin_factor);
-                double duty_y = value_layout.baseline_y;
+                duty_total_width = duty_number_width + pct_spacing +
+                                   fmax(pct_ext.x_advance, pct_ext.width);
+            }
 
-                const double overlap_padding =
-                    fmax(1.0, scale_value_avg(params, 2.0));
-                double duty_available_width =
+            if (duty_total_width > duty_available_width)
+            {
+                duty_x = fmax(safe_x,
+                              value_layout.block_left - duty_total_width -
+                                  overlap_padding);
+                duty_available_width =
                     value_layout.block_left - duty_x - overlap_padding;
-                if (duty_available_width <= 0.0)
-                {
-                    duty_x = safe_x;
-                    duty_available_width =
-                        value_layout.block_left - duty_x - overlap_padding;
-                }
-
-                const double min_duty_font =
-                    fmax(8.0, value_layout.font_size * 0.32);
-                while (duty_total_width > duty_available_width &&
-                       duty_font > min_duty_font)
-                {
-                    duty_font *= 0.90;
-                    if (duty_font < min_duty_font)
-                        duty_font = min_duty_font;
-
-                    pct_font = duty_font / 2.05;
-                    cairo_set_font_size(cr, duty_font);
-                    cairo_font_extents(cr, &duty_fext);
-                    cairo_text_extents(cr, duty_buf, &duty_text_ext);
-
-                    cairo_set_font_size(cr, pct_font);
-                    cairo_text_extents(cr, "%", &pct_ext);
-                    cairo_set_font_size(cr, duty_font);
-
-                    duty_number_width =
-                        fmax(duty_text_ext.x_advance, duty_text_ext.width);
-                    duty_total_width = duty_number_width + pct_spacing +
-                                       fmax(pct_ext.x_advance, pct_ext.width);
-                }
-
-                if (duty_total_width > duty_available_width)
-                {
-                    duty_x = fmax(safe_x,
-                                  value_layout.block_left - duty_total_width -
-                                      overlap_padding);
-                    duty_available_width =
-                        value_layout.block_left - duty_x - overlap_padding;
-                }
-
-                if (duty_available_width > 0.0)
-                {
-                    cairo_set_font_size(cr, duty_font);
-                    set_cairo_color(cr, value_color);
-                    cairo_move_to(cr, duty_x, duty_y);
-                    cairo_show_text(cr, duty_buf);
-
-                    /* Render % as superscript at ~49% of duty font */
-                    const double num_top = duty_y + duty_text_ext.y_bearing;
-                    const double pct_top = num_top +
-                                           (duty_text_ext.height * 0.08);
-                    const double pct_x = duty_x + duty_number_width +
-                                         pct_spacing - pct_ext.x_bearing;
-                    const double pct_y = pct_top - pct_ext.y_bearing;
-
-                    cairo_set_font_size(cr, pct_font);
-                    cairo_move_to(cr, pct_x, pct_y);
-                    cairo_show_text(cr, "%");
-                    cairo_set_font_size(cr, duty_font);
-                }
             }
-        }
-    }
 
-    // Draw label (CPU, GPU, or LIQ) in a dedicated bottom lane anchored to the bar.
-    if (label_text)
-    {
-        const Color *label_color = &config->font_color_label;
-        double label_safe_x = bar_x;
-        double label_safe_width = effective_bar_width;
-        const double left_margin_factor =
-            (config->layout_label_margin_left > 0)
-                ? (config->layout_label_margin_left / 100.0)
-                : 0.01;
-
-        calculate_text_lane_bounds(config, params, label_box_y,
-                                   label_box_height, 0, bar_x,
-                                   effective_bar_width, &label_safe_x,
-                                   &label_safe_width);
-
-        const double label_left_padding = label_safe_width * left_margin_factor;
-        const double label_inner_padding_y =
-            fmax(2.0, scale_value_avg(params, 4.0));
-        const double available_label_width =
-            fmax(24.0, label_safe_width - label_left_padding);
-        const double available_label_height =
-            fmax(12.0, label_box_height - (2.0 * label_inner_padding_y));
-        const double min_label_font_size =
-            (config->font_size_labels > 0.0f)
-                ? fmax(12.0, scale_value_avg(params,
-                                             (double)config->font_size_labels) *
-                                 0.70)
-                : fmax(12.0, scale_value_avg(params, 12.0));
-
-        cairo_select_font_face(cr, config->font_face, CAIRO_FONT_SLANT_NORMAL,
-                               CAIRO_FONT_WEIGHT_NORMAL);
-
-        while (1)
-        {
-            cairo_set_font_size(cr, label_font_size);
-            cairo_font_extents(cr, &label_font_ext);
-            cairo_text_extents(cr, label_text, &label_text_ext);
-
-            if ((fmax(label_text_ext.x_advance, label_text_ext.width) <=
-                     available_label_width &&
-                 (label_font_ext.ascent + label_font_ext.descent) <=
-                     available_label_height) ||
-                label_font_size <= min_label_font_size)
-                break;
+            if (duty_available_width > 0.0)
+            {
+                cairo_set_font_size(cr, duty_font);
+                set_cairo_color(cr, value_color);
+                cairo_move_to(cr, duty_x, duty_y);
+                cairo_show_text(cr, duty_buf);
+
+                /* Render % as superscript at ~49% of duty font */
+                const double num_top = duty_y + duty_text_ext.y_bearing;
+                const double pct_top = num_top +
+                                       (duty_text_ext.height * 0.08);
+                const double pct_x = duty_x + duty_number_width +
+                                     pct_spacing - pct_ext.x_bearing;
+                const double pct_y = pct_top - pct_ext.y_bearing;
 
-            label_font_size *= 0.94;
-            if (label_font_size < min_label_font_size)
-                label_font_size = min_label_font_size;
+                cairo_set_font_size(cr, pct_font);
+                cairo_move_to(cr, pct_x, pct_y);
+                cairo_show_text(cr, "%");
+                cairo_set_font_size(cr, duty_font);
+            }
         }
-
-        set_cairo_color(cr, label_color);
-
-        double label_x = label_safe_x + (label_safe_width * left_margin_factor);
-        double final_label_y =
-            label_box_y + label_inner_padding_y + label_font_ext.ascent;
-
-        // Apply user-defined offsets using the uniform layout scale.
-        label_x += get_scaled_label_offset_x(config, params);
-        final_label_y += get_scaled_label_offset_y(config, params);
-
-        cairo_move_to(cr, label_x, final_label_y);
-        cairo_show_text(cr, label_text);
     }
 
     // Draw extra info (freq/watts/RPM) below the label if enabled
     if (config->circle_show_extra_info)
     {
-        char extra_buf[64] = {0};
-        char line2_buf[64] = {0};
-        const int has_extra_line =
-            get_extra_info_text(data, slot_value, extra_buf, sizeof(extra_buf));
-        const int has_rpm_line =
-            get_extra_info_line2(data, slot_value, line2_buf, sizeof(line2_buf));
-
         if (verbose_logging)
         {
             log_message(LOG_INFO, "Circle extra info: slot=%s line1=%s line2=%s",
@@ -819,17 +1109,15 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
             const int line_count =
                 (has_extra_line ? 1 : 0) + (has_rpm_line ? 1 : 0);
 
-            cairo_select_font_face(cr, config->font_face,
-                                   CAIRO_FONT_SLANT_NORMAL,
-                                   CAIRO_FONT_WEIGHT_BOLD);
+            select_text_font(cr, config, TEXT_WEIGHT_BOLD);
 
             while (1)
             {
                 cairo_set_font_size(cr, extra_font_size);
-                cairo_font_extents(cr, &font_ext);
-                cairo_text_extents(cr, has_extra_line ? extra_buf : "",
+                measure_font(cr, &font_ext);
+                measure_text(cr, has_extra_line ? extra_buf : "",
                                    &extra_text_ext);
-                cairo_text_extents(cr, has_rpm_line ? line2_buf : "",
+                measure_text(cr, has_rpm_line ? line2_buf : "",
                                    &line2_text_ext);
 
                 const double line_height = font_ext.ascent + font_ext.descent;
@@ -873,7 +1161,7 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
                 double extra_x =
                     (int)lround(params->safe_content_margin) +
                     ((double)params->safe_bar_width * left_margin_factor) +
-                    get_scaled_label_offset_x(config, params);
+                    plan->label_offset_x;
 
                 if (has_extra_line)
                     render_text_with_small_units(cr, extra_font_size,
@@ -892,6 +1180,13 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
             }
         }
     }
+
+    if (partial)
+        cairo_restore(cr);
+
+    next.valid = layered;
+    next.layer_key = state->layer.key;
+    *frame = next;
 }
 
 /**
@@ -899,137 +1194,117 @@ static void draw_single_sensor(cairo_t *cr, const struct Config *config,
  */
 static void render_display_content(cairo_t *cr, const struct Config *config,
                                    const monitor_sensor_data_t *data,
-                                   const ScalingParams *params)
+                                   const LayoutPlan *plan, int retained)
 {
-    if (!cr || !config || !data || !params)
+    if (!cr || !config || !data || !plan)
         return;
 
-    paint_display_background(cr, config);
-
-    // Update sensor mode (check if configured interval elapsed)
-    update_sensor_mode(config);
-
-    // Get current slot value and draw sensor
-    const char *slot_value = get_slot_value_by_index(config, current_slot_index);
-    draw_single_sensor(cr, config, params, data, slot_value);
-}
-
-/**
- * @brief Render circle mode display to PNG file.
- * @details Creates PNG image with single sensor, does NOT upload.
- */
-static int render_circle_display(const struct Config *config,
-                                 const monitor_sensor_data_t *data,
-                                 const char *device_name)
-{
-    if (!config || !data)
+    // Get current slot value and draw sensor (paints its own static layer)
+    const char *slot_value =
+        get_slot_value_by_index(config, get_circle_state(config)->current_slot_index);
+    if (!slot_value || !slot_is_active(slot_value))
     {
-        log_message(LOG_ERROR, "Invalid parameters for circle mode rendering");
-        return 0;
+        get_circle_state(config)->frame.valid = 0;
+        clear_frame_canvas(cr);
+        paint_display_background(cr, config);
+        return;
     }
+    draw_single_sensor(cr, config, plan, data, slot_value, retained);
+}
 
-    ScalingParams params = {0};
-    calculate_scaling_params(config, &params, device_name);
-
-    // Verbose logging only
-    if (verbose_logging)
-    {
-        const char *slot_value = get_slot_value_by_index(config, current_slot_index);
-        const char *label = get_slot_label(config, data, slot_value);
-        float temp = get_slot_temperature(data, slot_value);
-        log_message(LOG_INFO,
-                    "Circle mode: slot=%s label=%s temp=%.1f extra_info=%s font=%s",
-                    slot_value ? slot_value : "none",
-                    label ? label : "unknown", temp,
-                    config->circle_show_extra_info ? "on" : "off",
-                    config->font_face[0] ? config->font_face : "default");
-    }
+/** @brief Render the current slot into the display's frame canvas. */
+static cairo_surface_t *render_circle_canvas(const struct Config *config,
+                                             const monitor_sensor_data_t *data)
+{
+    const LayoutPlan *plan = get_layout_plan(config);
 
     cairo_surface_t *surface = NULL;
-    cairo_t *cr = create_cairo_context(config, &surface);
+    int retained = 0;
+    cairo_t *cr = begin_frame_canvas(config, circle_states, &surface, &retained);
     if (!cr)
-        return 0;
+        return NULL;
 
-    render_display_content(cr, config, data, &params);
+    render_display_content(cr, config, data, plan, retained);
 
-    cairo_surface_flush(surface);
+    end_frame_canvas(cr);
     if (cairo_status(cr) != CAIRO_STATUS_SUCCESS)
     {
+        get_circle_state(config)->frame.valid = 0;
         log_message(LOG_ERROR, "Cairo drawing error: %s",
                     cairo_status_to_string(cairo_status(cr)));
-        cairo_destroy(cr);
-        cairo_surface_destroy(surface);
-        return 0;
+        return NULL;
     }
 
-    // Write PNG to file
-    cairo_status_t write_status =
-        cairo_surface_write_to_png(surface, config->paths_image_coolerdash);
-    cairo_destroy(cr);
-    cairo_surface_destroy(surface);
+    return surface;
+}
 
-    if (write_status != CAIRO_STATUS_SUCCESS)
+/**
+ * @brief Render the circle mode frame into the display's frame canvas.
+ * @details Advances the slot rotation and renders the current slot. The
+ * returned surface belongs to the canvas and stays valid until the next frame
+ * of the same display.
+ */
+cairo_surface_t *render_circle_surface(const struct Config *config,
+                                       const monitor_sensor_data_t *data)
+{
+    if (!config || !data)
     {
-        log_message(LOG_ERROR, "Failed to write PNG: %s",
-                    cairo_status_to_string(write_status));
-        return 0;
+        log_message(LOG_ERROR, "Invalid parameters for circle mode rendering");
+        return NULL;
     }
 
-    return 1;
+    // Update sensor mode (check if configured interval elapsed)
+    update_sensor_mode(config);
+    return render_circle_canvas(config, data);
 }
 
 /**
- * @brief High-level entry point for circle mode rendering.
- * @details Collects sensor data, renders circle display using
- * render_circle_display(), and sends to LCD device.
+ * @brief Advance the slot rotation and describe it from the current slot on.
  */
-void draw_circle_image(const struct Config *config)
+int get_circle_rotation(const struct Config *config, CircleRotation *rotation)
 {
-    if (!config)
-    {
-        log_message(LOG_ERROR, "Invalid config for circle mode");
-        return;
-    }
+    if (!config || !rotation)
+        return 0;
 
-    // Get device information
-    char device_uid[128] = {0};
-    char device_name[128] = {0};
-    int screen_width = 0, screen_height = 0;
+    update_sensor_mode(config);
+    const CircleState *state = get_circle_state(config);
 
-    const int device_available =
-        get_cached_lcd_device_data(config, device_uid, sizeof(device_uid),
-                                   device_name, sizeof(device_name),
-                                   &screen_width, &screen_height);
+    memset(rotation, 0, sizeof(*rotation));
+    rotation->interval = get_switch_interval(config);
+    const double elapsed = difftime(time(NULL), state->last_switch_time);
+    rotation->elapsed = elapsed < 0.0                   ? 0.0
+                        : elapsed > rotation->interval ? rotation->interval
+                                                        : elapsed;
 
-    // Get sensor data
-    monitor_sensor_data_t data = {0};
-    if (!get_sensor_monitor_data(config, &data))
+    int slot = find_next_active_slot(config, state->current_slot_index);
+    while (slot >= 0 && rotation->count < 3)
     {
-        log_message(LOG_WARNING, "Circle mode: Failed to get sensor data");
-        return;
+        rotation->slots[rotation->count++] = slot;
+        slot = find_next_active_slot(config, (slot + 1) % 3);
+        if (slot == rotation->slots[0])
+            break;
     }
+    return rotation->count;
+}
 
-    // Render circle display with device name for circular display detection
-    if (!render_circle_display(config, &data, device_name))
+/**
+ * @brief Render one slot without advancing the rotation.
+ * @details Used for animations; the rotation's current slot is restored.
+ */
+cairo_surface_t *render_circle_slot_surface(const struct Config *config,
+                                            const monitor_sensor_data_t *data,
+                                            int slot_index)
+{
+    if (!config || !data || slot_index < 0 || slot_index > 2)
     {
-        log_message(LOG_ERROR, "Circle display rendering failed");
-        return;
+        log_message(LOG_ERROR, "Invalid parameters for circle mode rendering");
+        return NULL;
     }
 
-    // Send to LCD if available
-    if (is_session_initialized() && device_available && device_uid[0] != '\0')
-    {
-        const char *name =
-            (device_name[0] != '\0') ? device_name : "Unknown Device";
-        log_message(LOG_INFO, "Sending circle image to LCD: %s [%s]", name,
-                    device_uid);
-
-        send_image_to_lcd(config, config->paths_image_coolerdash, device_uid);
-
-        log_message(LOG_INFO, "Circle LCD image uploaded successfully");
-    }
-    else
-    {
-        log_message(LOG_WARNING, "Skipping circle LCD upload - device not available");
-    }
+    CircleState *state = get_circle_state(config);
+    const int current_slot_index = state->current_slot_index;
+    state->current_slot_index = slot_index;
+    cairo_surface_t *surface = render_circle_canvas(config, data);
+    state->current_slot_index = current_slot_index;
+    return surface;
 }
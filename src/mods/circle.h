@@ -17,6 +17,7 @@
 
 // Include necessary headers
 // cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
 #include <stddef.h>
 #include <stdint.h>
 // cppcheck-suppress-end missingIncludeSystem
@@ -28,11 +29,45 @@
 struct Config;
 
 /**
- * @brief Collects sensor data and renders circle mode display.
- * @details High-level entry point function that retrieves temperature data and
- * triggers alternating single-sensor display rendering.
+ * @brief Render the circle mode frame (one slot, alternating).
+ * @details Called by render_display_frame(), which hashes and encodes the
+ * surface. Draws into the display's long-lived frame canvas.
+ * @return Canvas surface (do not destroy), or NULL on failure
  */
-void draw_circle_image(const struct Config *config);
+cairo_surface_t *render_circle_surface(const struct Config *config,
+                                       const monitor_sensor_data_t *data);
+
+/**
+ * @brief Slot rotation of a circle display, current slot first.
+ */
+typedef struct
+{
+    int slots[3];    /**< Active slot indices (0-2) in rotation order */
+    int count;       /**< Number of active slots */
+    double elapsed;  /**< Seconds the first slot has been shown */
+    double interval; /**< Seconds each slot is shown */
+} CircleRotation;
+
+/**
+ * @brief Advance the slot rotation and describe it.
+ * @details Applies the switch interval like render_circle_surface(), so an
+ * animation built from it plays in step with the unanimated rotation.
+ * @param config Display configuration
+ * @param rotation Output rotation
+ * @return Number of active slots
+ */
+int get_circle_rotation(const struct Config *config, CircleRotation *rotation);
+
+/**
+ * @brief Render one slot of the rotation into the display's frame canvas.
+ * @details Does not advance the rotation. The surface stays valid until the
+ * next frame of the same display.
+ * @param slot_index Slot 0-2, see get_circle_rotation()
+ * @return Canvas surface (do not destroy), or NULL on failure
+ */
+cairo_surface_t *render_circle_slot_surface(const struct Config *config,
+                                            const monitor_sensor_data_t *data,
+                                            int slot_index);
 
 /**
  * @brief Resets circle mode state for config reload (SIGHUP).
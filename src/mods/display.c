@@ -20,17 +20,24 @@
 // cppcheck-suppress-begin missingIncludeSystem
 #include <cairo/cairo.h>
 #include <math.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <time.h>
 // cppcheck-suppress-end missingIncludeSystem
 
 // Include project headers
 #include "../device/config.h"
+#include "../device/stats.h"
 #include "../srv/cc_conf.h"
+#include "../srv/cc_main.h"
 #include "../srv/cc_sensor.h"
 #include "circle.h"
 #include "display.h"
 #include "dual.h"
+#include "history.h"
+#include "text.h"
 
 // Circle inscribe factor for circular displays (1/sqrt(2) ~ 0.7071)
 #ifndef M_SQRT1_2
@@ -46,6 +53,17 @@ static double clamp_double(double value, double min_value, double max_value)
     return value;
 }
 
+/**
+ * @brief Get the per-display state slot of a display config.
+ */
+int get_display_state_index(const struct Config *config)
+{
+    if (!config || config->display_index < 0 ||
+        config->display_index >= MAX_LCD_DISPLAYS)
+        return 0;
+    return config->display_index;
+}
+
 /**
  * @brief Convert color component into a 0.0-1.0 range.
  */
@@ -225,8 +243,166 @@ void format_slot_value_text(char *buffer, size_t buffer_size,
         snprintf(buffer, buffer_size, "%d", (int)temp_value);
 }
 
+// ============================================================================
+// Value Text Fitting
+// ============================================================================
+
+// Memoised value fits; values oscillate between a few readings per slot
+#define VALUE_FIT_CACHE_SIZE 64
+
+/** @brief Inputs of a value text fit; equal requests yield equal fits. */
+typedef struct
+{
+    const cairo_font_face_t *face;
+    unsigned long text_generation; // Faces are only unique per generation
+    char text[16];
+    int is_temp;
+    int grow; // Grow towards the available box (no configured font size)
+    double degree_spacing;
+    double available_width;
+    double available_height;
+    double preferred_font_size;
+    double min_font_size;
+    double growth_step;
+} ValueTextRequest;
+
+/** @brief Fitted font sizes and extents of a value and its degree sign. */
+typedef struct
+{
+    double font_size;
+    double degree_font_size;
+    double number_width;
+    double total_width;
+    cairo_text_extents_t number_ext;
+    cairo_text_extents_t degree_ext;
+} ValueTextFit;
+
+/**
+ * @brief Fits of recent value texts, keyed by the full request.
+ * @details A hit skips the fitting search, so the layout pass and the draw
+ * pass of a frame measure a value at most once, and unchanged values are not
+ * measured again.
+ */
+static struct
+{
+    ValueTextRequest request;
+    ValueTextFit fit;
+    int valid;
+} value_fits[VALUE_FIT_CACHE_SIZE];
+
+/**
+ * @brief Measure a value text at one font size.
+ * @return Content height (number ink or font height, whichever is larger)
+ */
+static double measure_value_text(cairo_t *cr, const ValueTextRequest *request,
+                                 double font_size, ValueTextFit *fit)
+{
+    cairo_font_extents_t font_ext = {0};
+
+    cairo_set_font_size(cr, font_size);
+    measure_font(cr, &font_ext);
+    measure_text(cr, request->text, &fit->number_ext);
+    fit->number_width = fmax(fit->number_ext.x_advance, fit->number_ext.width);
+
+    fit->font_size = font_size;
+    fit->degree_font_size = font_size / 2.05;
+    fit->degree_ext = (cairo_text_extents_t){0};
+    if (request->is_temp)
+    {
+        cairo_set_font_size(cr, fit->degree_font_size);
+        measure_text(cr, "\xC2\xB0", &fit->degree_ext);
+        cairo_set_font_size(cr, font_size);
+    }
+
+    fit->total_width = fit->number_width +
+                       (request->is_temp
+                            ? (request->degree_spacing +
+                               fmax(fit->degree_ext.x_advance,
+                                    fit->degree_ext.width))
+                            : 0.0);
+    return fmax(fit->number_ext.height, font_ext.ascent + font_ext.descent);
+}
+
+/**
+ * @brief Shrink from the preferred size until the value fits, then grow in
+ * halving steps towards the available box.
+ */
+static void fit_value_text(cairo_t *cr, const ValueTextRequest *request,
+                           ValueTextFit *fit)
+{
+    double font_size = request->preferred_font_size;
+
+    while (1)
+    {
+        const double content_height =
+            measure_value_text(cr, request, font_size, fit);
+
+        if ((fit->total_width <= request->available_width &&
+             content_height <= request->available_height) ||
+            font_size <= request->min_font_size)
+            break;
+
+        font_size *= 0.93;
+        if (font_size < request->min_font_size)
+            font_size = request->min_font_size;
+    }
+
+    if (!request->grow)
+        return;
+
+    double growth_step = request->growth_step;
+    while (growth_step >= 0.25)
+    {
+        while (1)
+        {
+            ValueTextFit candidate;
+            const double candidate_height = measure_value_text(
+                cr, request, fit->font_size + growth_step, &candidate);
+
+            if (candidate.total_width > request->available_width ||
+                candidate_height > request->available_height)
+                break;
+
+            *fit = candidate;
+        }
+
+        growth_step *= 0.5;
+    }
+}
+
+/**
+ * @brief Get the fit of a value text, measuring only on a cache miss.
+ */
+static void get_value_text_fit(cairo_t *cr, const ValueTextRequest *request,
+                               ValueTextFit *fit)
+{
+    // Faces not owned by the text cache may be freed and their address reused
+    if (!request->face)
+    {
+        fit_value_text(cr, request, fit);
+        return;
+    }
+
+    const uint64_t hash =
+        hash_layer_key(STATIC_LAYER_KEY_SEED, request, sizeof(*request));
+    const size_t index = (size_t)(hash % VALUE_FIT_CACHE_SIZE);
+    if (value_fits[index].valid &&
+        memcmp(&value_fits[index].request, request, sizeof(*request)) == 0)
+    {
+        *fit = value_fits[index].fit;
+        return;
+    }
+
+    fit_value_text(cr, request, fit);
+    value_fits[index].request = *request;
+    value_fits[index].fit = *fit;
+    value_fits[index].valid = 1;
+}
+
 /**
  * @brief Measure and optionally render a right-aligned sensor value block.
+ * @details The font size search is memoised per value text and box, so the
+ * draw pass after a layout pass reuses the layout pass result.
  */
 void layout_and_render_slot_value(cairo_t *cr,
                                   const monitor_sensor_data_t *data,
@@ -292,108 +468,29 @@ void layout_and_render_slot_value(cairo_t *cr,
             ? fmax(8.0, scale_value_avg(params, 8.0))
             : fmax(12.0, scale_value_avg(params, 14.0));
 
-    cairo_text_extents_t number_ext = {0};
-    cairo_text_extents_t degree_ext = {0};
-    cairo_font_extents_t font_ext = {0};
-    double font_size = preferred_font_size;
-    double degree_font_size = font_size / 2.05;
-    double total_width = 0.0;
-    double number_width = 0.0;
-    double content_height = 0.0;
-
-    while (1)
-    {
-        cairo_set_font_size(cr, font_size);
-        cairo_font_extents(cr, &font_ext);
-        cairo_text_extents(cr, value_text, &number_ext);
-        number_width = fmax(number_ext.x_advance, number_ext.width);
-
-        degree_font_size = font_size / 2.05;
-        degree_ext = (cairo_text_extents_t){0};
-        if (is_temp)
-        {
-            cairo_set_font_size(cr, degree_font_size);
-            cairo_text_extents(cr, "\xC2\xB0", &degree_ext);
-            cairo_set_font_size(cr, font_size);
-        }
-
-        total_width = number_width +
-                      (is_temp
-                           ? (degree_spacing +
-                              fmax(degree_ext.x_advance, degree_ext.width))
-                           : 0.0);
-        content_height = fmax(number_ext.height,
-                              font_ext.ascent + font_ext.descent);
-
-        if ((total_width <= available_width &&
-             content_height <= available_height) ||
-            font_size <= min_font_size)
-            break;
-
-        font_size *= 0.93;
-        if (font_size < min_font_size)
-            font_size = min_font_size;
-    }
-
-    if (configured_scaled_font_size <= 0.0)
-    {
-        double growth_step = fmax(0.5, scale_value_avg(params, 1.0));
-
-        while (growth_step >= 0.25)
-        {
-            while (1)
-            {
-                const double candidate_font_size = font_size + growth_step;
-                cairo_text_extents_t candidate_number_ext = {0};
-                cairo_text_extents_t candidate_degree_ext = {0};
-                cairo_font_extents_t candidate_font_ext = {0};
-                double candidate_number_width = 0.0;
-                double candidate_total_width = 0.0;
-                double candidate_content_height = 0.0;
-                double candidate_degree_font_size = candidate_font_size / 2.05;
-
-                cairo_set_font_size(cr, candidate_font_size);
-                cairo_font_extents(cr, &candidate_font_ext);
-                cairo_text_extents(cr, value_text, &candidate_number_ext);
-                candidate_number_width =
-                    fmax(candidate_number_ext.x_advance,
-                         candidate_number_ext.width);
-
-                if (is_temp)
-                {
-                    cairo_set_font_size(cr, candidate_degree_font_size);
-                    cairo_text_extents(cr, "\xC2\xB0", &candidate_degree_ext);
-                    cairo_set_font_size(cr, candidate_font_size);
-                }
-
-                candidate_total_width = candidate_number_width +
-                                        (is_temp
-                                             ? (degree_spacing +
-                                                fmax(candidate_degree_ext.x_advance,
-                                                     candidate_degree_ext.width))
-                                             : 0.0);
-                candidate_content_height =
-                    fmax(candidate_number_ext.height,
-                         candidate_font_ext.ascent +
-                             candidate_font_ext.descent);
-
-                if (candidate_total_width > available_width ||
-                    candidate_content_height > available_height)
-                    break;
-
-                font_size = candidate_font_size;
-                degree_font_size = candidate_degree_font_size;
-                number_ext = candidate_number_ext;
-                degree_ext = candidate_degree_ext;
-                font_ext = candidate_font_ext;
-                number_width = candidate_number_width;
-                total_width = candidate_total_width;
-                content_height = candidate_content_height;
-            }
-
-            growth_step *= 0.5;
-        }
-    }
+    ValueTextRequest request;
+    memset(&request, 0, sizeof(request)); // Zero padding, requests are hashed
+    request.face = get_text_font(cr);
+    request.text_generation = get_text_cache_generation();
+    cc_safe_strcpy(request.text, sizeof(request.text), value_text);
+    request.is_temp = is_temp;
+    request.grow = (configured_scaled_font_size <= 0.0);
+    request.degree_spacing = degree_spacing;
+    request.available_width = available_width;
+    request.available_height = available_height;
+    request.preferred_font_size = preferred_font_size;
+    request.min_font_size = min_font_size;
+    request.growth_step = fmax(0.5, scale_value_avg(params, 1.0));
+
+    ValueTextFit fit;
+    get_value_text_fit(cr, &request, &fit);
+
+    const double font_size = fit.font_size;
+    const double degree_font_size = fit.degree_font_size;
+    const double number_width = fit.number_width;
+    const double total_width = fit.total_width;
+    const cairo_text_extents_t number_ext = fit.number_ext;
+    const cairo_text_extents_t degree_ext = fit.degree_ext;
 
     const double requested_right =
         box_x + box_width - right_margin + offset_x;
@@ -512,8 +609,202 @@ static void paint_background_overlay(cairo_t *cr, const struct Config *config)
     cairo_restore(cr);
 }
 
+/**
+ * @brief Scale and paint a decoded background image using the configured fit.
+ */
+static void paint_background_image(cairo_t *cr, const struct Config *config,
+                                   cairo_surface_t *background)
+{
+    const int image_width = cairo_image_surface_get_width(background);
+    const int image_height = cairo_image_surface_get_height(background);
+
+    double scale_x = 1.0;
+    double scale_y = 1.0;
+    double offset_x = 0.0;
+    double offset_y = 0.0;
+
+    if (strcmp(config->display_background_image_fit, "contain") == 0)
+    {
+        const double scale = fmin((double)config->display_width / image_width,
+                                  (double)config->display_height / image_height);
+        scale_x = scale;
+        scale_y = scale;
+        offset_x = ((double)config->display_width - image_width * scale) / 2.0;
+        offset_y = ((double)config->display_height - image_height * scale) / 2.0;
+    }
+    else if (strcmp(config->display_background_image_fit, "stretch") == 0)
+    {
+        scale_x = (double)config->display_width / image_width;
+        scale_y = (double)config->display_height / image_height;
+    }
+    else
+    {
+        const double scale = fmax((double)config->display_width / image_width,
+                                  (double)config->display_height / image_height);
+        scale_x = scale;
+        scale_y = scale;
+        offset_x = ((double)config->display_width - image_width * scale) / 2.0;
+        offset_y = ((double)config->display_height - image_height * scale) / 2.0;
+    }
+
+    cairo_save(cr);
+    cairo_translate(cr, offset_x, offset_y);
+    cairo_scale(cr, scale_x, scale_y);
+    cairo_set_source_surface(cr, background, 0.0, 0.0);
+    cairo_pattern_set_filter(cairo_get_source(cr), CAIRO_FILTER_BILINEAR);
+    cairo_paint(cr);
+    cairo_restore(cr);
+}
+
+/**
+ * @brief Pre-composited background (color + scaled image + overlay).
+ * @details Rebuilt only when one of the key fields changes. A failed load is
+ * cached as well (surface == NULL) so a broken file is not decoded every frame.
+ */
+static struct BackgroundCache
+{
+    int valid;
+    cairo_surface_t *surface;
+    char path[CONFIG_MAX_PATH_LEN];
+    time_t mtime;
+    off_t size;
+    char fit[16];
+    uint16_t width;
+    uint16_t height;
+    Color background_color;
+    float overlay_opacity;
+} background_caches[MAX_LCD_DISPLAYS] = {0};
+
+/**
+ * @brief Background image file state of each display.
+ * @details stat()ed once per frame by begin_frame_canvas(); the static layer
+ * key and the background cache both read it, so a frame costs one syscall.
+ */
+static struct BackgroundFile
+{
+    int probed;
+    int exists;
+    time_t mtime;
+    off_t size;
+} background_files[MAX_LCD_DISPLAYS] = {0};
+
+/**
+ * @brief stat() the background image of a display into background_files.
+ */
+static void probe_background_file(const struct Config *config)
+{
+    struct BackgroundFile *file = &background_files[get_display_state_index(config)];
+    struct stat st;
+
+    memset(file, 0, sizeof(*file));
+    file->probed = 1;
+    if (config->paths_image_background[0] != '\0' &&
+        stat(config->paths_image_background, &st) == 0)
+    {
+        file->exists = 1;
+        file->mtime = st.st_mtime;
+        file->size = st.st_size;
+    }
+}
+
+/**
+ * @brief Background image file state of this frame, probed on first use.
+ */
+static const struct BackgroundFile *get_background_file(const struct Config *config)
+{
+    const struct BackgroundFile *file =
+        &background_files[get_display_state_index(config)];
+    if (!file->probed)
+        probe_background_file(config);
+    return file;
+}
+
+/**
+ * @brief Release one cached background surface.
+ */
+static void release_background_cache(struct BackgroundCache *cache)
+{
+    if (cache->surface)
+        cairo_surface_destroy(cache->surface);
+    memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * @brief Release the cached background surfaces of all displays.
+ */
+static void reset_background_cache(void)
+{
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        release_background_cache(&background_caches[i]);
+    memset(background_files, 0, sizeof(background_files));
+}
+
+/**
+ * @brief Check whether the cached background matches config and file state.
+ */
+static int background_cache_matches(const struct BackgroundCache *cache,
+                                    const struct Config *config,
+                                    const struct BackgroundFile *file)
+{
+    const Color *bg = &config->display_background_color;
+
+    return cache->valid &&
+           strcmp(cache->path, config->paths_image_background) == 0 &&
+           cache->mtime == file->mtime &&
+           cache->size == file->size &&
+           strcmp(cache->fit, config->display_background_image_fit) == 0 &&
+           cache->width == config->display_width &&
+           cache->height == config->display_height &&
+           cache->background_color.r == bg->r &&
+           cache->background_color.g == bg->g &&
+           cache->background_color.b == bg->b &&
+           cache->overlay_opacity == config->display_background_overlay_opacity;
+}
+
+/**
+ * @brief Decode the background image and composite it into a display-sized
+ * surface.
+ * @return Composited surface, or NULL if the image could not be loaded
+ */
+static cairo_surface_t *build_background_surface(const struct Config *config)
+{
+    cairo_surface_t *background =
+        cairo_image_surface_create_from_png(config->paths_image_background);
+
+    if (!background || cairo_surface_status(background) != CAIRO_STATUS_SUCCESS ||
+        cairo_image_surface_get_width(background) <= 0 ||
+        cairo_image_surface_get_height(background) <= 0)
+    {
+        if (background)
+            cairo_surface_destroy(background);
+        return NULL;
+    }
+
+    cairo_surface_t *composite = NULL;
+    cairo_t *cr = create_cairo_context(config, &composite);
+    if (!cr)
+    {
+        cairo_surface_destroy(background);
+        return NULL;
+    }
+
+    set_cairo_color(cr, &config->display_background_color);
+    cairo_paint(cr);
+    paint_background_image(cr, config, background);
+    paint_background_overlay(cr, config);
+
+    cairo_destroy(cr);
+    cairo_surface_destroy(background);
+    cairo_surface_flush(composite);
+
+    return composite;
+}
+
 /**
  * @brief Paint configured background image or fallback color.
+ * @details The decoded and scaled image is cached as a display-sized surface
+ * keyed on path, mtime, fit mode, display size and overlay, so a steady-state
+ * frame costs a single cairo_paint.
  */
 void paint_display_background(cairo_t *cr, const struct Config *config)
 {
@@ -522,67 +813,36 @@ void paint_display_background(cairo_t *cr, const struct Config *config)
     if (!cr || !config)
         return;
 
-    set_cairo_color(cr, &config->display_background_color);
-    cairo_paint(cr);
-
     if (config->paths_image_background[0] != '\0')
     {
-        cairo_surface_t *background =
-            cairo_image_surface_create_from_png(config->paths_image_background);
+        struct BackgroundCache *cache =
+            &background_caches[get_display_state_index(config)];
+        const struct BackgroundFile *file = get_background_file(config);
+        const int file_ok = file->exists;
 
-        if (background &&
-            cairo_surface_status(background) == CAIRO_STATUS_SUCCESS)
+        if (file_ok && !background_cache_matches(cache, config, file))
         {
-            const int image_width = cairo_image_surface_get_width(background);
-            const int image_height = cairo_image_surface_get_height(background);
-
-            if (image_width > 0 && image_height > 0)
-            {
-                double scale_x = 1.0;
-                double scale_y = 1.0;
-                double offset_x = 0.0;
-                double offset_y = 0.0;
-
-                if (strcmp(config->display_background_image_fit, "contain") == 0)
-                {
-                    const double scale = fmin((double)config->display_width / image_width,
-                                              (double)config->display_height / image_height);
-                    scale_x = scale;
-                    scale_y = scale;
-                    offset_x = ((double)config->display_width - image_width * scale) / 2.0;
-                    offset_y = ((double)config->display_height - image_height * scale) / 2.0;
-                }
-                else if (strcmp(config->display_background_image_fit, "stretch") == 0)
-                {
-                    scale_x = (double)config->display_width / image_width;
-                    scale_y = (double)config->display_height / image_height;
-                }
-                else
-                {
-                    const double scale = fmax((double)config->display_width / image_width,
-                                              (double)config->display_height / image_height);
-                    scale_x = scale;
-                    scale_y = scale;
-                    offset_x = ((double)config->display_width - image_width * scale) / 2.0;
-                    offset_y = ((double)config->display_height - image_height * scale) / 2.0;
-                }
-
-                cairo_save(cr);
-                cairo_translate(cr, offset_x, offset_y);
-                cairo_scale(cr, scale_x, scale_y);
-                cairo_set_source_surface(cr, background, 0.0, 0.0);
-                cairo_pattern_set_filter(cairo_get_source(cr),
-                                         CAIRO_FILTER_BILINEAR);
-                cairo_paint(cr);
-                cairo_restore(cr);
-
-                paint_background_overlay(cr, config);
-                cairo_surface_destroy(background);
-                last_failed_path[0] = '\0';
-                return;
-            }
+            release_background_cache(cache);
+            cache->surface = build_background_surface(config);
+            SAFE_STRCPY(cache->path, config->paths_image_background);
+            cache->mtime = file->mtime;
+            cache->size = file->size;
+            SAFE_STRCPY(cache->fit, config->display_background_image_fit);
+            cache->width = config->display_width;
+            cache->height = config->display_height;
+            cache->background_color = config->display_background_color;
+            cache->overlay_opacity = config->display_background_overlay_opacity;
+            cache->valid = 1;
+        }
 
-            cairo_surface_destroy(background);
+        if (file_ok && cache->surface)
+        {
+            cairo_save(cr);
+            cairo_set_source_surface(cr, cache->surface, 0.0, 0.0);
+            cairo_paint(cr);
+            cairo_restore(cr);
+            last_failed_path[0] = '\0';
+            return;
         }
 
         if (strcmp(last_failed_path, config->paths_image_background) != 0)
@@ -594,7 +854,8 @@ void paint_display_background(cairo_t *cr, const struct Config *config)
         }
     }
 
-    return;
+    set_cairo_color(cr, &config->display_background_color);
+    cairo_paint(cr);
 }
 
 /**
@@ -626,6 +887,80 @@ void draw_rounded_rectangle_path(cairo_t *cr, int x, int y, int width,
     cairo_close_path(cr);
 }
 
+// Smallest value span a sparkline is scaled to, so sensor noise stays flat
+#define SPARKLINE_MIN_SPAN 1.0
+
+/**
+ * @brief Draw the history sparkline of a slot inside its bar.
+ * @details Samples are placed by timestamp from the oldest (left) to the
+ * newest (right) and scaled to the window min/max; the window average is
+ * drawn as a dashed line. Clipped to the rounded bar shape.
+ */
+void draw_slot_sparkline(cairo_t *cr, const struct Config *config,
+                         const char *slot_value, int x, int y, int width,
+                         int height, double radius)
+{
+    if (!cr || !config || width <= 0 || height <= 0)
+        return;
+
+    const SlotHistory *history = get_slot_history(config, slot_value);
+    float first_time = 0.0f, last_time = 0.0f;
+    if (!history || history->count < 2 ||
+        !get_slot_history_sample(history, 0, NULL, &first_time) ||
+        !get_slot_history_sample(history, history->count - 1, NULL,
+                                 &last_time) ||
+        last_time <= first_time)
+        return;
+
+    double low = get_slot_history_min(history);
+    double high = get_slot_history_max(history);
+    if (high - low < SPARKLINE_MIN_SPAN)
+    {
+        const double mid = (high + low) / 2.0;
+        low = mid - SPARKLINE_MIN_SPAN / 2.0;
+        high = mid + SPARKLINE_MIN_SPAN / 2.0;
+    }
+
+    const double line_width = clamp_double(height * 0.08, 1.0, 3.0);
+    const double inset = fmax(line_width, height * 0.15);
+    const double top = y + inset;
+    const double span_y = height - 2.0 * inset;
+    const double x_scale = width / (double)(last_time - first_time);
+    const double y_scale = span_y > 0.0 ? span_y / (high - low) : 0.0;
+
+    cairo_save(cr);
+    draw_rounded_rectangle_path(cr, x, y, width, height, radius);
+    cairo_clip(cr);
+    cairo_set_line_width(cr, line_width);
+    cairo_set_line_join(cr, CAIRO_LINE_JOIN_ROUND);
+
+    // Window average
+    const double dash = fmax(2.0, line_width * 2.0);
+    const double avg_y = top + (high - get_slot_history_avg(history)) * y_scale;
+    set_cairo_color_alpha(cr, &config->font_color_temp, 0.35);
+    cairo_set_dash(cr, &dash, 1, 0.0);
+    cairo_move_to(cr, x, avg_y);
+    cairo_line_to(cr, x + width, avg_y);
+    cairo_stroke(cr);
+    cairo_set_dash(cr, NULL, 0, 0.0);
+
+    // Trend line
+    set_cairo_color_alpha(cr, &config->font_color_temp, 0.8);
+    for (int i = 0; i < history->count; i++)
+    {
+        float value = 0.0f, time = 0.0f;
+        get_slot_history_sample(history, i, &value, &time);
+        const double px = x + (time - first_time) * x_scale;
+        const double py = top + (high - value) * y_scale;
+        if (i == 0)
+            cairo_move_to(cr, px, py);
+        else
+            cairo_line_to(cr, px, py);
+    }
+    cairo_stroke(cr);
+    cairo_restore(cr);
+}
+
 /**
  * @brief Draw degree symbol at calculated position with proper font scaling.
  */
@@ -669,63 +1004,861 @@ cairo_t *create_cairo_context(const struct Config *config,
         return NULL;
     }
 
+    cc_count_allocation();
     return cr;
 }
 
+// ============================================================================
+// Frame Canvas
+// ============================================================================
+
 /**
- * @brief Calculate dynamic scaling parameters based on display dimensions.
- * @details Display shape detection: NZXT Kraken 240x240=rect, >240=circular.
+ * @brief Long-lived render target of one display.
+ * @details Created on the first frame and recreated only when the display
+ * size changes or the context entered an error state.
  */
-void calculate_scaling_params(const struct Config *config,
-                              ScalingParams *params, const char *device_name)
+typedef struct
 {
-    const double base_width = 240.0;
-    const double base_height = 240.0;
-    const double min_dimension =
-        (config->display_width < config->display_height)
-            ? (double)config->display_width
-            : (double)config->display_height;
-    const double base_min_dimension =
-        (base_width < base_height) ? base_width : base_height;
+    cairo_surface_t *surface;
+    cairo_t *cr;
+    const void *owner; // Renderer that drew the current pixels
+    int width;
+    int height;
+} FrameCanvas;
 
-    params->scale_x = config->display_width / base_width;
-    params->scale_y = config->display_height / base_height;
-    params->scale_uniform =
-        (base_min_dimension > 0.0) ? (min_dimension / base_min_dimension) : 1.0;
+static FrameCanvas frame_canvases[MAX_LCD_DISPLAYS] = {0};
 
-    params->is_circular = is_circular_display_device(
-        device_name, config->display_width, config->display_height);
-    params->inscribe_factor = params->is_circular ? M_SQRT1_2 : 1.0;
+static void release_frame_canvas(FrameCanvas *canvas)
+{
+    if (canvas->cr)
+        cairo_destroy(canvas->cr);
+    if (canvas->surface)
+        cairo_surface_destroy(canvas->surface);
+    memset(canvas, 0, sizeof(*canvas));
+}
 
-    // Calculate safe area width from detected device geometry only.
-    const double safe_area_width =
-        config->display_width * params->inscribe_factor;
-    const float content_scale = (config->display_content_scale_factor > 0.0f &&
-                                 config->display_content_scale_factor <= 1.0f)
-                                    ? config->display_content_scale_factor
-                                    : 0.98f; // Fallback: 98%
-    // Apply bar_width percentage
-    const double bar_width_factor = (config->layout_bar_width > 0)
-                                        ? (config->layout_bar_width / 100.0)
-                                        : 0.98;
-    params->safe_bar_width =
-        (int)(safe_area_width * content_scale * bar_width_factor);
-    params->safe_content_margin =
-        (config->display_width - params->safe_bar_width) / 2.0;
+void clear_frame_canvas(cairo_t *cr)
+{
+    if (!cr)
+        return;
+    cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+    cairo_paint(cr);
+    cairo_set_operator(cr, CAIRO_OPERATOR_OVER);
+}
 
-    params->corner_radius = 8.0 * params->scale_uniform;
+/**
+ * @brief Get the frame canvas of a display.
+ * @details Cleared unless the caller asked for retained pixels and the
+ * canvas still holds its last frame.
+ */
+cairo_t *begin_frame_canvas(const struct Config *config, const void *owner,
+                            cairo_surface_t **surface, int *retained)
+{
+    FrameCanvas *canvas = &frame_canvases[get_display_state_index(config)];
 
-    // Calculate vertical margins (0 = auto-detect based on display shape)
-    if (config->display_margin_top != 0)
-        params->margin_top = config->display_margin_top * params->scale_uniform;
-    else
-        params->margin_top = params->is_circular
-                                 ? (config->display_height * 0.03)
-                                 : 0.0;
+    if (canvas->cr && (canvas->width != config->display_width ||
+                       canvas->height != config->display_height ||
+                       cairo_status(canvas->cr) != CAIRO_STATUS_SUCCESS))
+        release_frame_canvas(canvas);
 
-    if (config->display_margin_bottom != 0)
-        params->margin_bottom = config->display_margin_bottom * params->scale_uniform;
-    else
+    if (!canvas->cr)
+    {
+        canvas->cr = create_cairo_context(config, &canvas->surface);
+        if (!canvas->cr)
+            return NULL;
+        canvas->width = config->display_width;
+        canvas->height = config->display_height;
+    }
+
+    // One stat() of the background image serves the whole frame
+    probe_background_file(config);
+
+    // Frame state (clip, source, font, dash) is dropped in end_frame_canvas()
+    cairo_save(canvas->cr);
+    const int keep = canvas->owner != NULL && canvas->owner == owner;
+    if (retained)
+        *retained = keep;
+    if (!retained || !keep)
+        clear_frame_canvas(canvas->cr);
+    canvas->owner = owner;
+
+    *surface = canvas->surface;
+    return canvas->cr;
+}
+
+/**
+ * @brief Finish a frame started with begin_frame_canvas().
+ */
+void end_frame_canvas(cairo_t *cr)
+{
+    if (!cr)
+        return;
+    cairo_restore(cr);
+    cairo_surface_flush(cairo_get_target(cr));
+}
+
+/**
+ * @brief Free the frame canvases of all displays.
+ */
+void release_frame_canvases(void)
+{
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        release_frame_canvas(&frame_canvases[i]);
+}
+
+DirtyRect make_dirty_rect(double left, double top, double right,
+                          double bottom, double margin)
+{
+    DirtyRect rect = {0};
+    if (!(right > left) || !(bottom > top))
+        return rect;
+
+    const int x0 = (int)floor(left - margin);
+    const int y0 = (int)floor(top - margin);
+    rect.x = x0;
+    rect.y = y0;
+    rect.width = (int)ceil(right + margin) - x0;
+    rect.height = (int)ceil(bottom + margin) - y0;
+    return rect;
+}
+
+void clip_dirty_rects(cairo_t *cr, const DirtyRect *rects, int count)
+{
+    if (!cr || !rects)
+        return;
+
+    cairo_new_path(cr);
+    for (int i = 0; i < count; i++)
+    {
+        if (rects[i].width > 0 && rects[i].height > 0)
+            cairo_rectangle(cr, rects[i].x, rects[i].y, rects[i].width,
+                            rects[i].height);
+    }
+    cairo_clip(cr);
+}
+
+// ============================================================================
+// Layout Plan
+// ============================================================================
+
+static LayoutPlan layout_plans[MAX_LCD_DISPLAYS] = {0};
+
+/**
+ * @brief Resolve the render style of a slot value (one SensorConfig search).
+ */
+static void compile_slot_style(const struct Config *config,
+                               const char *slot_value, SlotStyle *style)
+{
+    static const Color default_color = {0, 255, 0, 1};
+
+    memset(style, 0, sizeof(*style));
+    for (int i = 0; i < 4; i++)
+        style->band_colors[i] = default_color;
+    style->max_scale = 115.0f;
+    style->font_size = config->font_size_temp;
+
+    const SensorConfig *sc = slot_value ? get_sensor_config(config, slot_value)
+                                        : NULL;
+    if (!sc)
+        return;
+
+    style->has_thresholds = 1;
+    style->thresholds[0] = sc->threshold_1;
+    style->thresholds[1] = sc->threshold_2;
+    style->thresholds[2] = sc->threshold_3;
+    style->band_colors[0] = sc->threshold_1_bar;
+    style->band_colors[1] = sc->threshold_2_bar;
+    style->band_colors[2] = sc->threshold_3_bar;
+    style->band_colors[3] = sc->threshold_4_bar;
+    if (sc->max_scale > 0.0f)
+        style->max_scale = sc->max_scale;
+    style->offset_x = sc->offset_x;
+    style->offset_y = sc->offset_y;
+    if (sc->font_size_temp > 0.0f)
+        style->font_size = sc->font_size_temp;
+    style->value_to_bar_gap = sc->value_to_bar_gap;
+    style->label_to_bar_gap = sc->label_to_bar_gap;
+    SAFE_STRCPY(style->label, sc->label);
+}
+
+/**
+ * @brief Build the layout plan from config and cached device information.
+ */
+void build_layout_plan(const struct Config *config)
+{
+    if (!config)
+        return;
+
+    LayoutPlan *plan = &layout_plans[get_display_state_index(config)];
+
+    char device_uid[128] = {0};
+    char device_name[CC_NAME_SIZE] = {0};
+    int screen_width = 0, screen_height = 0;
+    get_cached_lcd_device_data(config, device_uid, sizeof(device_uid),
+                               device_name, sizeof(device_name),
+                               &screen_width, &screen_height);
+
+    const unsigned int generation = plan->generation + 1;
+    memset(plan, 0, sizeof(*plan));
+    plan->generation = generation;
+
+    ScalingParams *params = &plan->params;
+    calculate_scaling_params(config, params, device_name);
+
+    plan->degree_spacing = get_scaled_degree_spacing(config, params);
+    plan->bar_gap = get_scaled_bar_gap(config, params);
+    plan->slot_bar_height[0] = get_scaled_slot_bar_height(config, params, "1");
+    plan->slot_bar_height[1] = get_scaled_slot_bar_height(config, params, "2");
+    plan->slot_bar_height[2] = get_scaled_slot_bar_height(config, params, "3");
+    plan->bar_border_width = get_scaled_bar_border_width(config, params);
+    plan->label_spacing = get_effective_label_spacing(config, params);
+    plan->label_font_size = get_preferred_label_font_size(config, params);
+    plan->label_offset_x = get_scaled_label_offset_x(config, params);
+    plan->label_offset_y = get_scaled_label_offset_y(config, params);
+    compile_slot_style(config, config->sensor_slot_1, &plan->slot_styles[0]);
+    compile_slot_style(config, config->sensor_slot_2, &plan->slot_styles[1]);
+    compile_slot_style(config, config->sensor_slot_3, &plan->slot_styles[2]);
+    plan->valid = 1;
+
+    log_message(LOG_INFO, "%s display detected (device: %s, inscribe factor: %.4f)",
+                params->is_circular ? "Circular" : "Rectangular",
+                device_name[0] != '\0' ? device_name : "unknown",
+                params->inscribe_factor);
+}
+
+/**
+ * @brief Get the current layout plan, building it first if needed.
+ */
+const LayoutPlan *get_layout_plan(const struct Config *config)
+{
+    const LayoutPlan *plan = &layout_plans[get_display_state_index(config)];
+    if (!plan->valid)
+        build_layout_plan(config);
+    return plan;
+}
+
+// ============================================================================
+// Frame Dedup Cache
+// ============================================================================
+
+// 64-bit FNV-1a parameters
+#define FRAME_HASH_OFFSET 0xcbf29ce484222325ULL
+#define FRAME_HASH_PRIME 0x100000001b3ULL
+
+/**
+ * @brief Hash of the last frame sent to each LCD.
+ * @details Checked by the render stage and updated by the upload stage, so
+ * access is serialised by frame_cache_lock.
+ */
+static struct
+{
+    int valid;
+    uint64_t uploaded_hash;
+    struct timespec uploaded_at;
+    int animation_rejected; // CoolerControl refused an animated upload
+} frame_caches[MAX_LCD_DISPLAYS] = {0};
+
+static pthread_mutex_t frame_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Hash the visible pixels of an ARGB32 image surface.
+ * @details Hashes 8 bytes per step and skips row padding beyond width * 4.
+ */
+static uint64_t hash_surface_pixels(cairo_surface_t *surface)
+{
+    const unsigned char *pixels = cairo_image_surface_get_data(surface);
+    const int width = cairo_image_surface_get_width(surface);
+    const int height = cairo_image_surface_get_height(surface);
+    const int stride = cairo_image_surface_get_stride(surface);
+    uint64_t hash = FRAME_HASH_OFFSET;
+
+    if (!pixels || width <= 0 || height <= 0)
+        return hash;
+
+    const size_t row_bytes = (size_t)width * 4;
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row = pixels + (size_t)y * (size_t)stride;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= row_bytes; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, row + i, sizeof(word));
+            hash ^= word;
+            hash *= FRAME_HASH_PRIME;
+        }
+        for (; i < row_bytes; i++)
+        {
+            hash ^= row[i];
+            hash *= FRAME_HASH_PRIME;
+        }
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Check whether a frame hash matches the last uploaded frame.
+ * @details Returns 0 when the force refresh interval has elapsed so the LCD
+ * cannot go stale. A force refresh interval of 0 disables deduplication.
+ */
+static int is_frame_unchanged(const struct Config *config, uint64_t hash)
+{
+    if (config->display_force_refresh_interval <= 0)
+        return 0;
+
+    const int index = get_display_state_index(config);
+    pthread_mutex_lock(&frame_cache_lock);
+    int unchanged = frame_caches[index].valid &&
+                    hash == frame_caches[index].uploaded_hash;
+    if (unchanged)
+    {
+        const struct timespec *uploaded_at = &frame_caches[index].uploaded_at;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        const double elapsed =
+            (double)(now.tv_sec - uploaded_at->tv_sec) +
+            (double)(now.tv_nsec - uploaded_at->tv_nsec) / 1e9;
+        unchanged = elapsed < (double)config->display_force_refresh_interval;
+    }
+    pthread_mutex_unlock(&frame_cache_lock);
+
+    return unchanged;
+}
+
+/**
+ * @brief Record a frame hash as successfully uploaded.
+ */
+static void mark_frame_uploaded(const struct Config *config, uint64_t hash)
+{
+    const int index = get_display_state_index(config);
+    pthread_mutex_lock(&frame_cache_lock);
+    frame_caches[index].uploaded_hash = hash;
+    clock_gettime(CLOCK_MONOTONIC, &frame_caches[index].uploaded_at);
+    frame_caches[index].valid = 1;
+    pthread_mutex_unlock(&frame_cache_lock);
+}
+
+/** @brief Send single frames from now on (set by the upload stage). */
+static void reject_circle_animation(const struct Config *config)
+{
+    const int index = get_display_state_index(config);
+    pthread_mutex_lock(&frame_cache_lock);
+    frame_caches[index].animation_rejected = 1;
+    pthread_mutex_unlock(&frame_cache_lock);
+}
+
+/**
+ * @brief Forget the last uploaded frame so the next one is always sent.
+ */
+void reset_frame_cache(void)
+{
+    pthread_mutex_lock(&frame_cache_lock);
+    memset(frame_caches, 0, sizeof(frame_caches));
+    pthread_mutex_unlock(&frame_cache_lock);
+}
+
+// ============================================================================
+// Frame Output
+// ============================================================================
+
+/** @brief Set per display once auto mode found the multipart endpoint missing. */
+static int upload_file_fallback[MAX_LCD_DISPLAYS] = {0};
+
+/** @brief Check if frames are uploaded from memory instead of a file. */
+static int use_memory_upload(const struct Config *config)
+{
+    if (strcmp(config->display_upload_mode, "memory") == 0)
+        return 1;
+    return strcmp(config->display_upload_mode, "auto") == 0 &&
+           !upload_file_fallback[get_display_state_index(config)];
+}
+
+/** @brief Write an encoded frame to a PNG file. */
+static int write_frame_png_file(const char *path, const png_buffer_t *png)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+    {
+        log_message(LOG_ERROR, "Failed to write PNG image: %s", path);
+        return 0;
+    }
+
+    const size_t written = fwrite(png->data, 1, png->size, file);
+    const int closed = (fclose(file) == 0);
+    if (written != png->size || !closed)
+    {
+        log_message(LOG_ERROR, "Failed to write PNG image: %s", path);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Send an encoded frame to the LCD.
+ * @details In auto mode a missing multipart endpoint switches to file uploads
+ * for the rest of the session; the current frame is then written to disk and
+ * sent by path.
+ */
+static int upload_frame_image(const struct Config *config,
+                              const DisplayFrame *frame, const char *device_uid)
+{
+    const png_buffer_t *png = &frame->png;
+    if (frame->animated && !use_memory_upload(config))
+    {
+        // The image file is a PNG path; the next frame is rendered unanimated
+        reject_circle_animation(config);
+        return 0;
+    }
+
+    if (!use_memory_upload(config))
+        return write_frame_png_file(config->paths_image_coolerdash, png) &&
+               send_image_to_lcd(config, config->paths_image_coolerdash,
+                                 device_uid);
+
+    int unsupported = 0;
+    if (send_image_data_to_lcd(config, png->data, png->size, frame->animated,
+                               device_uid, &unsupported))
+        return 1;
+
+    if (!unsupported)
+        return 0;
+
+    if (frame->animated)
+    {
+        log_message(LOG_STATUS,
+                    "LCD animation upload refused, sending single frames");
+        reject_circle_animation(config);
+        return 0;
+    }
+
+    if (strcmp(config->display_upload_mode, "auto") != 0)
+    {
+        log_message(LOG_ERROR,
+                    "LCD image upload endpoint not available, set upload_mode to \"file\"");
+        return 0;
+    }
+
+    log_message(LOG_STATUS,
+                "LCD image upload endpoint not available, using file uploads");
+    upload_file_fallback[get_display_state_index(config)] = 1;
+
+    return write_frame_png_file(config->paths_image_coolerdash, png) &&
+           send_image_to_lcd(config, config->paths_image_coolerdash,
+                             device_uid);
+}
+
+/** @brief Check if the configured display mode is circle mode. */
+static int is_circle_mode(const struct Config *config)
+{
+    return config->display_mode[0] != '\0' &&
+           strcmp(config->display_mode, "circle") == 0;
+}
+
+/** @brief Check if a display uploads its circle rotation as animation. */
+int is_circle_animated(const struct Config *config)
+{
+    if (!config || !is_circle_mode(config) || config->circle_animation != 1 ||
+        strcmp(config->display_upload_mode, "file") == 0)
+        return 0;
+
+    const int index = get_display_state_index(config);
+    pthread_mutex_lock(&frame_cache_lock);
+    const int rejected = frame_caches[index].animation_rejected;
+    pthread_mutex_unlock(&frame_cache_lock);
+    return !rejected;
+}
+
+/** @brief Animation delay of a slot shown for the given seconds, in 1/100 s. */
+static unsigned int slot_delay_cs(double seconds)
+{
+    return seconds > 0.0 ? (unsigned int)(seconds * 100.0 + 0.5) : 0;
+}
+
+/**
+ * @brief Render the circle rotation as one animated GIF.
+ * @details Every active slot is rendered once to hash the frame; slots are
+ * hashed in slot order, so only content changes count, not the rotation
+ * position. A changed rotation is rendered again into the GIF, starting at
+ * the current slot for its remaining time and ending with the time it has
+ * already been shown, so the looping animation keeps the rotation's rhythm.
+ * @return 1 on success, 0 on failure
+ */
+static int render_circle_animation(const struct Config *config,
+                                   const monitor_sensor_data_t *data,
+                                   const CircleRotation *rotation,
+                                   DisplayFrame *frame)
+{
+    const uint64_t render_start = stats_clock_ns();
+    uint64_t hash = FRAME_HASH_OFFSET;
+    int width = 0, height = 0;
+    for (int slot = 0; slot < 3; slot++)
+    {
+        int active = 0;
+        for (int i = 0; i < rotation->count; i++)
+            active |= (rotation->slots[i] == slot);
+        if (!active)
+            continue;
+
+        cairo_surface_t *surface = render_circle_slot_surface(config, data, slot);
+        if (!surface)
+        {
+            log_message(LOG_ERROR, "Display rendering failed");
+            return 0;
+        }
+        hash = (hash ^ hash_surface_pixels(surface)) * FRAME_HASH_PRIME;
+        width = cairo_image_surface_get_width(surface);
+        height = cairo_image_surface_get_height(surface);
+    }
+
+    frame->hash = hash;
+    frame->changed = !is_frame_unchanged(config, frame->hash);
+    frame->poll_start_ns = data->poll_start_ns;
+    frame->animated = 1;
+    record_stage_time(STAT_RENDER, render_start);
+    if (!frame->changed)
+        return 1;
+
+    const uint64_t encode_start = stats_clock_ns();
+    int ok = begin_gif_animation(width, height, &frame->png);
+    for (int i = 0; ok && i <= rotation->count; i++)
+    {
+        const double seconds = (i == 0) ? rotation->interval - rotation->elapsed
+                               : (i == rotation->count) ? rotation->elapsed
+                                                         : rotation->interval;
+        const unsigned int delay_cs = slot_delay_cs(seconds);
+        if (delay_cs == 0)
+            continue;
+
+        cairo_surface_t *surface = render_circle_slot_surface(
+            config, data, rotation->slots[i % rotation->count]);
+        ok = surface && add_gif_frame(surface, delay_cs, &frame->png);
+    }
+    ok = ok && finish_gif_animation(&frame->png);
+    if (!ok)
+    {
+        log_message(LOG_ERROR, "Failed to encode animated image");
+        return 0;
+    }
+    record_stage_time(STAT_ENCODE, encode_start);
+    return 1;
+}
+
+/**
+ * @brief Render and encode one frame.
+ * @param allow_animation 0 to always render a single frame (--preview)
+ */
+static int render_frame(const struct Config *config,
+                        const monitor_sensor_data_t *data, DisplayFrame *frame,
+                        int allow_animation)
+{
+    if (!config || !data || !frame)
+        return 0;
+
+    record_slot_history(config, data);
+
+    if (allow_animation && is_circle_animated(config))
+    {
+        CircleRotation rotation;
+        if (get_circle_rotation(config, &rotation) > 1)
+            return render_circle_animation(config, data, &rotation, frame);
+    }
+
+    // Circle mode: alternating single sensor, dual mode (default): all slots
+    const uint64_t render_start = stats_clock_ns();
+    cairo_surface_t *surface = is_circle_mode(config)
+                                   ? render_circle_surface(config, data)
+                                   : render_dual_surface(config, data);
+    if (!surface)
+    {
+        log_message(LOG_ERROR, "Display rendering failed");
+        return 0;
+    }
+
+    frame->hash = hash_surface_pixels(surface);
+    frame->changed = !is_frame_unchanged(config, frame->hash);
+    frame->poll_start_ns = data->poll_start_ns;
+    frame->animated = 0;
+    record_stage_time(STAT_RENDER, render_start);
+
+    if (frame->changed)
+    {
+        const uint64_t encode_start = stats_clock_ns();
+        if (!encode_png_frame(surface, config->display_png_compression,
+                              &frame->png))
+        {
+            log_message(LOG_ERROR, "Failed to encode PNG image");
+            return 0;
+        }
+        record_stage_time(STAT_ENCODE, encode_start);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Render and encode one frame for the configured display mode.
+ * @details Unchanged frames are hashed but not encoded.
+ */
+int render_display_frame(const struct Config *config,
+                         const monitor_sensor_data_t *data,
+                         DisplayFrame *frame)
+{
+    return render_frame(config, data, frame, 1);
+}
+
+/**
+ * @brief Upload a rendered frame to the LCD device.
+ * @details Frames that match the last upload are skipped, which also drops
+ * duplicates queued while an upload was in flight.
+ */
+int upload_display_frame(const struct Config *config, const DisplayFrame *frame)
+{
+    if (!config || !frame || frame->png.size == 0)
+        return 0;
+
+    if (is_frame_unchanged(config, frame->hash))
+        return 1;
+
+    char device_uid[128] = {0};
+    char device_name[256] = {0};
+    int screen_width = 0, screen_height = 0;
+
+    const int device_available =
+        get_cached_lcd_device_data(config, device_uid, sizeof(device_uid),
+                                   device_name, sizeof(device_name),
+                                   &screen_width, &screen_height);
+
+    if (!is_session_initialized() || !device_available || device_uid[0] == '\0')
+    {
+        log_message(LOG_WARNING, "Skipping LCD upload - device not available");
+        return 0;
+    }
+
+    const char *name = (device_name[0] != '\0') ? device_name : "Unknown Device";
+    log_message(LOG_INFO, "Sending %s%s image to LCD: %s [%s]",
+                is_circle_mode(config) ? "circle" : "dual",
+                frame->animated ? " animated" : "", name, device_uid);
+
+    const uint64_t upload_start = stats_clock_ns();
+    if (!upload_frame_image(config, frame, device_uid))
+        return 0;
+    record_stage_time(STAT_UPLOAD, upload_start);
+    record_frame_latency(frame->poll_start_ns, config->display_refresh_interval);
+
+    mark_frame_uploaded(config, frame->hash);
+    log_message(LOG_INFO, "LCD image uploaded successfully");
+    return 1;
+}
+
+/**
+ * @brief Render one frame into memory and write it to a file (--preview).
+ * @details Goes through render_display_frame() like the pipeline. The dedup
+ * cache is cleared first, so the frame is always encoded.
+ */
+int render_preview_image(const struct Config *config,
+                         const monitor_sensor_data_t *data,
+                         const char *output_path, size_t *png_size)
+{
+    if (!config || !data || !output_path || output_path[0] == '\0')
+        return 0;
+
+    DisplayFrame frame = {0};
+    reset_frame_cache();
+    int success = render_frame(config, data, &frame, 0) &&
+                  write_frame_png_file(output_path, &frame.png);
+    if (success && png_size)
+        *png_size = frame.png.size;
+
+    cleanup_png_encoder(&frame.png);
+    return success;
+}
+
+// ============================================================================
+// Static Layer Cache
+// ============================================================================
+
+/**
+ * @brief Mix a block of bytes into a static layer key (64-bit FNV-1a).
+ */
+uint64_t hash_layer_key(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FRAME_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Mix a string (including its terminator) into a static layer key.
+ */
+uint64_t hash_layer_key_string(uint64_t hash, const char *text)
+{
+    if (!text)
+        text = "";
+    return hash_layer_key(hash, text, strlen(text) + 1);
+}
+
+/**
+ * @brief Key describing the background image file state.
+ * @details The composited background is cached separately, so a replaced file
+ * must also invalidate every static layer that painted it. Uses the file
+ * state probed for this frame.
+ */
+static uint64_t background_state_key(const struct Config *config)
+{
+    uint64_t key = hash_layer_key_string(FRAME_HASH_OFFSET,
+                                         config->paths_image_background);
+    const struct BackgroundFile *file = get_background_file(config);
+
+    if (file->exists)
+    {
+        key = hash_layer_key(key, &file->mtime, sizeof(file->mtime));
+        key = hash_layer_key(key, &file->size, sizeof(file->size));
+    }
+
+    return key;
+}
+
+/**
+ * @brief Start redrawing a static layer if its key changed.
+ */
+cairo_t *begin_static_layer(const struct Config *config, StaticLayer *layer,
+                            uint64_t key)
+{
+    if (!config || !layer)
+        return NULL;
+
+    key = hash_layer_key(key, &(uint64_t){background_state_key(config)},
+                         sizeof(uint64_t));
+    if (layer->surface && layer->key == key)
+        return NULL;
+
+    release_static_layer(layer);
+
+    cairo_t *layer_cr = create_cairo_context(config, &layer->surface);
+    if (!layer_cr)
+        return NULL;
+
+    layer->key = key;
+    return layer_cr;
+}
+
+/**
+ * @brief Finish drawing a static layer started by begin_static_layer().
+ */
+void end_static_layer(StaticLayer *layer, cairo_t *layer_cr)
+{
+    if (!layer || !layer_cr)
+        return;
+
+    const cairo_status_t status = cairo_status(layer_cr);
+    cairo_destroy(layer_cr);
+
+    if (status != CAIRO_STATUS_SUCCESS)
+    {
+        log_message(LOG_ERROR, "Cairo static layer error: %s",
+                    cairo_status_to_string(status));
+        release_static_layer(layer);
+        return;
+    }
+
+    cairo_surface_flush(layer->surface);
+}
+
+/**
+ * @brief Copy a cached static layer onto the frame.
+ */
+int paint_static_layer(cairo_t *cr, const StaticLayer *layer)
+{
+    if (!cr || !layer || !layer->surface)
+        return 0;
+
+    cairo_save(cr);
+    cairo_set_operator(cr, CAIRO_OPERATOR_SOURCE);
+    cairo_set_source_surface(cr, layer->surface, 0.0, 0.0);
+    cairo_paint(cr);
+    cairo_restore(cr);
+
+    return 1;
+}
+
+/**
+ * @brief Release a static layer surface.
+ */
+void release_static_layer(StaticLayer *layer)
+{
+    if (!layer)
+        return;
+
+    if (layer->surface)
+        cairo_surface_destroy(layer->surface);
+    layer->surface = NULL;
+    layer->key = 0;
+}
+
+/**
+ * @brief Calculate dynamic scaling parameters based on display dimensions.
+ * @details Display shape detection: NZXT Kraken 240x240=rect, >240=circular.
+ */
+void calculate_scaling_params(const struct Config *config,
+                              ScalingParams *params, const char *device_name)
+{
+    const double base_width = 240.0;
+    const double base_height = 240.0;
+    const double min_dimension =
+        (config->display_width < config->display_height)
+            ? (double)config->display_width
+            : (double)config->display_height;
+    const double base_min_dimension =
+        (base_width < base_height) ? base_width : base_height;
+
+    // Zero padding too: renderers hash ScalingParams into static layer keys
+    memset(params, 0, sizeof(*params));
+    params->scale_x = config->display_width / base_width;
+    params->scale_y = config->display_height / base_height;
+    params->scale_uniform =
+        (base_min_dimension > 0.0) ? (min_dimension / base_min_dimension) : 1.0;
+
+    params->is_circular = is_circular_display_device(
+        device_name, config->display_width, config->display_height);
+    params->inscribe_factor = params->is_circular ? M_SQRT1_2 : 1.0;
+
+    // Calculate safe area width from detected device geometry only.
+    const double safe_area_width =
+        config->display_width * params->inscribe_factor;
+    const float content_scale = (config->display_content_scale_factor > 0.0f &&
+                                 config->display_content_scale_factor <= 1.0f)
+                                    ? config->display_content_scale_factor
+                                    : 0.98f; // Fallback: 98%
+    // Apply bar_width percentage
+    const double bar_width_factor = (config->layout_bar_width > 0)
+                                        ? (config->layout_bar_width / 100.0)
+                                        : 0.98;
+    params->safe_bar_width =
+        (int)(safe_area_width * content_scale * bar_width_factor);
+    params->safe_content_margin =
+        (config->display_width - params->safe_bar_width) / 2.0;
+
+    params->corner_radius = 8.0 * params->scale_uniform;
+
+    // Calculate vertical margins (0 = auto-detect based on display shape)
+    if (config->display_margin_top != 0)
+        params->margin_top = config->display_margin_top * params->scale_uniform;
+    else
+        params->margin_top = params->is_circular
+                                 ? (config->display_height * 0.03)
+                                 : 0.0;
+
+    if (config->display_margin_bottom != 0)
+        params->margin_bottom = config->display_margin_bottom * params->scale_uniform;
+    else
         params->margin_bottom = params->is_circular
                                     ? (config->display_height * 0.03)
                                     : 0.0;
@@ -753,6 +1886,29 @@ int slot_is_active(const char *slot_value)
     return strcmp(slot_value, "none") != 0;
 }
 
+/**
+ * @brief Get the render style of a sensor slot.
+ * @details Matches the slot fields by address, so no string is compared. The
+ * plan is not built here: the plan builder itself asks for slot values.
+ */
+const SlotStyle *get_slot_style(const struct Config *config,
+                                const char *slot_value, SlotStyle *scratch)
+{
+    const LayoutPlan *plan = &layout_plans[get_display_state_index(config)];
+    if (plan->valid)
+    {
+        if (slot_value == config->sensor_slot_1)
+            return &plan->slot_styles[0];
+        if (slot_value == config->sensor_slot_2)
+            return &plan->slot_styles[1];
+        if (slot_value == config->sensor_slot_3)
+            return &plan->slot_styles[2];
+    }
+
+    compile_slot_style(config, slot_value, scratch);
+    return scratch;
+}
+
 /**
  * @brief Get sensor value for a slot.
  */
@@ -783,20 +1939,21 @@ const char *get_slot_label(const struct Config *config,
     /* Check for custom label override in SensorConfig */
     if (config)
     {
-        const SensorConfig *sc = get_sensor_config(config, slot_value);
-        if (sc && sc->label[0] != '\0')
-            return sc->label;
+        static SlotStyle scratch;
+        const SlotStyle *style = get_slot_style(config, slot_value, &scratch);
+        if (style->label[0] != '\0')
+            return style->label;
     }
 
     /* Use device name from API if available (first two words only) */
     if (data)
     {
         const sensor_entry_t *entry = find_sensor_for_slot(data, slot_value);
-        if (entry && entry->device_name[0] != '\0')
+        if (entry && entry->device->name[0] != '\0')
         {
-            static char short_name[SENSOR_DEVICE_NAME_LEN];
+            static char short_name[CC_NAME_SIZE];
             cc_safe_strcpy(short_name, sizeof(short_name),
-                           entry->device_name);
+                           entry->device->name);
             /* Find end of second word */
             int words = 0;
             for (size_t i = 0; short_name[i] != '\0'; i++)
@@ -834,9 +1991,22 @@ const char *get_slot_label(const struct Config *config,
     return "???";
 }
 
+/** @brief Threshold band of a value: 0..3 (below threshold_1 .. above threshold_3). */
+static int threshold_band(const SlotStyle *style, float value)
+{
+    if (value < style->thresholds[0])
+        return 0;
+    else if (value < style->thresholds[1])
+        return 1;
+    else if (value < style->thresholds[2])
+        return 2;
+    else
+        return 3;
+}
+
 /**
  * @brief Get bar color for a sensor slot based on value.
- * @details Uses SensorConfig thresholds via get_sensor_config().
+ * @details Indexes the band colors of the compiled slot style.
  */
 Color get_slot_bar_color(const struct Config *config, const char *slot_value,
                          float value)
@@ -846,18 +2016,26 @@ Color get_slot_bar_color(const struct Config *config, const char *slot_value,
     if (!config || !slot_value)
         return default_color;
 
-    const SensorConfig *sc = get_sensor_config(config, slot_value);
-    if (!sc)
+    SlotStyle scratch;
+    const SlotStyle *style = get_slot_style(config, slot_value, &scratch);
+    if (!style->has_thresholds)
         return default_color;
 
-    if (value < sc->threshold_1)
-        return sc->threshold_1_bar;
-    else if (value < sc->threshold_2)
-        return sc->threshold_2_bar;
-    else if (value < sc->threshold_3)
-        return sc->threshold_3_bar;
-    else
-        return sc->threshold_4_bar;
+    return style->band_colors[threshold_band(style, value)];
+}
+
+/**
+ * @brief Get the threshold band of a sensor slot value.
+ */
+int get_slot_threshold_band(const struct Config *config, const char *slot_value,
+                            float value)
+{
+    if (!config || !slot_value)
+        return -1;
+
+    SlotStyle scratch;
+    const SlotStyle *style = get_slot_style(config, slot_value, &scratch);
+    return style->has_thresholds ? threshold_band(style, value) : -1;
 }
 
 /**
@@ -868,11 +2046,8 @@ float get_slot_max_scale(const struct Config *config, const char *slot_value)
     if (!config)
         return 115.0f;
 
-    const SensorConfig *sc = get_sensor_config(config, slot_value);
-    if (sc && sc->max_scale > 0.0f)
-        return sc->max_scale;
-
-    return 115.0f;
+    SlotStyle scratch;
+    return get_slot_style(config, slot_value, &scratch)->max_scale;
 }
 
 /**
@@ -961,8 +2136,8 @@ int get_slot_offset_x(const struct Config *config, const char *slot_value)
     if (!config || !slot_value)
         return 0;
 
-    const SensorConfig *sc = get_sensor_config(config, slot_value);
-    return sc ? sc->offset_x : 0;
+    SlotStyle scratch;
+    return get_slot_style(config, slot_value, &scratch)->offset_x;
 }
 
 /**
@@ -973,8 +2148,8 @@ int get_slot_offset_y(const struct Config *config, const char *slot_value)
     if (!config || !slot_value)
         return 0;
 
-    const SensorConfig *sc = get_sensor_config(config, slot_value);
-    return sc ? sc->offset_y : 0;
+    SlotStyle scratch;
+    return get_slot_style(config, slot_value, &scratch)->offset_y;
 }
 
 /**
@@ -1006,11 +2181,8 @@ float get_slot_font_size(const struct Config *config, const char *slot_value)
     if (!config)
         return 100.0f;
 
-    const SensorConfig *sc = get_sensor_config(config, slot_value);
-    if (sc && sc->font_size_temp > 0.0f)
-        return sc->font_size_temp;
-
-    return config->font_size_temp;
+    SlotStyle scratch;
+    return get_slot_style(config, slot_value, &scratch)->font_size;
 }
 
 /**
@@ -1022,27 +2194,73 @@ float get_slot_font_size(const struct Config *config, const char *slot_value)
  */
 void reset_display_state(void)
 {
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        layout_plans[i].valid = 0;
+    memset(upload_file_fallback, 0, sizeof(upload_file_fallback));
+    reset_frame_cache();
+    reset_background_cache();
+    reset_dual_state();
     reset_circle_state();
+    reset_slot_history();
+    reset_text_cache();
 }
 
-void draw_display_image(const struct Config *config)
+void invalidate_display_state(unsigned int changed)
 {
-    if (!config)
+    // Size, mode, upload and image paths reach every cache
+    if (changed & (CONFIG_SECTION_DISPLAY | CONFIG_SECTION_PATHS))
+    {
+        reset_display_state();
+        return;
+    }
+
+    // Slot history and background check their own keys and survive
+    if (changed & CONFIG_SECTION_FONT)
+        reset_text_cache();
+
+    // Static layers bake in colors, fonts, layout and thresholds
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        layout_plans[i].valid = 0;
+    reset_frame_cache();
+    reset_dual_state();
+    reset_circle_state();
+}
+
+void draw_display_image(const struct Config *displays, int display_count,
+                        const monitor_sensor_data_t *data)
+{
+    if (!displays || display_count <= 0 || display_count > MAX_LCD_DISPLAYS)
     {
         log_message(LOG_ERROR, "Invalid config parameter for draw_display_image");
         return;
     }
 
-    // Check display mode and dispatch to appropriate renderer
-    if (config->display_mode[0] != '\0' &&
-        strcmp(config->display_mode, "circle") == 0)
+    // Buffers keep their capacity across serial frames
+    static monitor_sensor_data_t sensor_data;
+    static DisplayFrame frames[MAX_LCD_DISPLAYS];
+
+    // One fetch feeds every display, unless the caller already has data
+    if (!data)
     {
-        // Circle mode: alternating single sensor display
-        draw_circle_image(config);
+        if (!get_sensor_monitor_data(displays, display_count, &sensor_data))
+        {
+            log_message(LOG_WARNING, "Failed to retrieve sensor data");
+            return;
+        }
+        data = &sensor_data;
     }
-    else
+
+    for (int i = 0; i < display_count; i++)
     {
-        // Dual mode (default): simultaneous CPU+GPU display
-        draw_dual_image(config);
+        if (!render_display_frame(&displays[i], data, &frames[i]))
+            continue;
+
+        if (!frames[i].changed)
+        {
+            log_message(LOG_INFO, "Frame unchanged, skipping LCD upload");
+            continue;
+        }
+
+        upload_display_frame(&displays[i], &frames[i]);
     }
 }
@@ -27,6 +27,8 @@
 #include "../device/config.h"
 // Include for monitor_sensor_data_t
 #include "../srv/cc_sensor.h"
+// Include for png_buffer_t
+#include "encoder.h"
 
 // ============================================================================
 // Mathematical Constants for Cairo Graphics
@@ -49,7 +51,8 @@
 
 /**
  * @brief Dynamic scaling parameters for display rendering.
- * @details Calculated once per frame based on display dimensions and device type.
+ * @details Calculated once per layout plan based on display dimensions and
+ * device type.
  */
 typedef struct
 {
@@ -65,6 +68,48 @@ typedef struct
     int is_circular;            /**< 1 if circular display, 0 if rectangular */
 } ScalingParams;
 
+/**
+ * @brief Render style of a sensor slot, resolved from its SensorConfig.
+ * @details Compiled into the layout plan, so the slot helpers read flat
+ * fields instead of searching the sensor configs by name every frame.
+ */
+typedef struct
+{
+    int has_thresholds;  /**< 0 = no SensorConfig: default color, band -1 */
+    float thresholds[3]; /**< threshold_1..3 */
+    Color band_colors[4]; /**< Bar color per threshold band */
+    float max_scale;
+    int offset_x;
+    int offset_y;
+    float font_size; /**< Per-sensor size, or the global font_size_temp */
+    float value_to_bar_gap;
+    float label_to_bar_gap;
+    char label[32]; /**< Custom label, "" = automatic */
+} SlotStyle;
+
+/**
+ * @brief Precomputed layout plan shared by all display modes.
+ * @details Built once at startup and after a config reload. Holds the scaling
+ * parameters and every Config-derived scaled value the renderers need, so the
+ * per-frame path does no layout math. Mode modules derive their own geometry
+ * from it and recompute only when generation changes.
+ */
+typedef struct
+{
+    int valid;
+    unsigned int generation; /**< Incremented on every rebuild */
+    ScalingParams params;
+    int degree_spacing;
+    int bar_gap;
+    int slot_bar_height[3]; /**< Scaled bar height for slot 1/2/3 */
+    double bar_border_width;
+    double label_spacing;
+    double label_font_size; /**< Preferred (unfitted) label font size */
+    int label_offset_x;
+    int label_offset_y;
+    SlotStyle slot_styles[3]; /**< Compiled style of slot 1/2/3 */
+} LayoutPlan;
+
 /**
  * @brief Measured layout for a rendered sensor value block.
  */
@@ -79,18 +124,82 @@ typedef struct
     double font_size;
 } SlotValueLayout;
 
+/**
+ * @brief Retained surface for frame content that does not change per tick.
+ * @details Holds background, bar frames and labels. Redrawn only when the key
+ * built by the renderer (config, ScalingParams, label geometry) changes.
+ */
+typedef struct
+{
+    cairo_surface_t *surface;
+    uint64_t key;
+} StaticLayer;
+
+/** @brief Initial value for keys built with hash_layer_key(). */
+#define STATIC_LAYER_KEY_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Encoded frame handed from rendering to upload.
+ * @details The image buffer keeps its capacity, so frames can be recycled
+ * between pipeline stages without allocating.
+ */
+typedef struct
+{
+    png_buffer_t png;       /**< Encoded PNG, or GIF if animated (valid if changed) */
+    uint64_t hash;          /**< Pixel hash for upload deduplication */
+    uint64_t poll_start_ns; /**< Sensor poll the frame shows (frame latency) */
+    int changed;            /**< 0 if identical to the last uploaded frame */
+    int animated;           /**< 1 if png holds an animated circle rotation */
+} DisplayFrame;
+
 /**
  * @brief Main display dispatcher - routes to appropriate rendering mode.
- * @details High-level entry point that examines configuration and dispatches to
- * either dual mode (CPU+GPU simultaneously) or circle mode (alternating
- * display). This is the primary interface called by the main daemon loop.
- * @param config Configuration containing display mode and rendering parameters
+ * @details Serial entry point used for the initial frame. Fetches sensor data
+ * once (unless given), then renders and uploads a frame per display in either
+ * dual mode (CPU+GPU simultaneously) or circle mode (alternating display).
+ * @param displays Per-display configurations (see load_display_configs())
+ * @param display_count Number of displays
+ * @param data Sensor data to render (startup probe), or NULL to fetch
  */
-void draw_display_image(const struct Config *config);
+void draw_display_image(const struct Config *displays, int display_count,
+                        const monitor_sensor_data_t *data);
 
-/** @brief Reset display state on config reload (SIGHUP); delegates to active mode. */
+/**
+ * @brief Get the per-display state slot of a display config.
+ * @details Renderer caches (layout plan, static layers, frame dedup) are kept
+ * per display and indexed by Config.display_index.
+ * @return Index in 0..MAX_LCD_DISPLAYS-1
+ */
+int get_display_state_index(const struct Config *config);
+
+/** @brief Reset display state of all displays on config reload (SIGHUP). */
 void reset_display_state(void);
 
+/**
+ * @brief Drop only the render caches affected by changed config sections.
+ * @details Used by the config watch reload. Display and path changes reset
+ * everything like reset_display_state(). Otherwise slot history, the
+ * background and (unless the font changed) text metrics are kept and only
+ * the static layers are redrawn. Layout plans must be rebuilt afterwards.
+ * @param changed Bit mask of config_section_t values (diff_config_sections())
+ */
+void invalidate_display_state(unsigned int changed);
+
+/**
+ * @brief Build the layout plan from config and cached device information.
+ * @details Called at startup and after reload_daemon_config(). Logs the
+ * detected display shape once.
+ * @param config Configuration with final display dimensions
+ */
+void build_layout_plan(const struct Config *config);
+
+/**
+ * @brief Get the current layout plan, building it first if needed.
+ * @param config Configuration used if the plan must be built
+ * @return Layout plan (never NULL)
+ */
+const LayoutPlan *get_layout_plan(const struct Config *config);
+
 // ============================================================================
 // Shared Cairo Rendering Helpers
 // ============================================================================
@@ -115,6 +224,155 @@ void calculate_scaling_params(const struct Config *config,
 cairo_t *create_cairo_context(const struct Config *config,
                               cairo_surface_t **surface);
 
+/**
+ * @brief Get the long-lived frame canvas of a display.
+ * @details The surface and context are kept across frames and only recreated
+ * when the display size changes, so steady-state rendering does not allocate.
+ * Pair every successful call with end_frame_canvas(); do not destroy the
+ * context or surface.
+ *
+ * Without a retained pointer the canvas is cleared. With one, the pixels of
+ * the owner's last frame are kept and *retained is set to 1, so a renderer
+ * can redraw only changed regions; otherwise the canvas is cleared and
+ * *retained is 0.
+ * @param config Configuration with display dimensions
+ * @param owner Address unique to the calling renderer
+ * @param surface Output pointer to the canvas surface
+ * @param retained Optional output: 1 if the canvas holds the owner's last frame
+ * @return Cairo context with a saved state, or NULL on failure
+ */
+cairo_t *begin_frame_canvas(const struct Config *config, const void *owner,
+                            cairo_surface_t **surface, int *retained);
+
+/**
+ * @brief Clear a frame canvas to transparent.
+ * @details For renderers that asked for retained pixels but redraw the whole
+ * frame.
+ */
+void clear_frame_canvas(cairo_t *cr);
+
+/** @brief Restore the canvas state and flush the surface after drawing. */
+void end_frame_canvas(cairo_t *cr);
+
+/** @brief Free the frame canvases of all displays (shutdown). */
+void release_frame_canvases(void);
+
+/**
+ * @brief Pixel-aligned frame region redrawn by a partial frame.
+ */
+typedef struct
+{
+    int x;
+    int y;
+    int width;
+    int height;
+} DirtyRect;
+
+/**
+ * @brief Build the pixel-aligned rectangle covering a box plus a margin.
+ * @details Inverted or empty boxes yield an empty rectangle.
+ */
+DirtyRect make_dirty_rect(double left, double top, double right,
+                          double bottom, double margin);
+
+/**
+ * @brief Restrict drawing to the union of dirty rectangles.
+ * @details Empty rectangles are skipped; callers bracket the clip with
+ * cairo_save()/cairo_restore().
+ */
+void clip_dirty_rects(cairo_t *cr, const DirtyRect *rects, int count);
+
+/**
+ * @brief Clear the frame dedup cache so the next frame is always uploaded.
+ */
+void reset_frame_cache(void);
+
+/**
+ * @brief Render and encode one frame for the configured display mode.
+ * @details Sets frame->changed to 0 and skips encoding when the frame matches
+ * the last uploaded one. With is_circle_animated() the frame is the whole
+ * rotation as an animated GIF.
+ * @param config Configuration with display mode and PNG compression level
+ * @param data Sensor data to render
+ * @param frame Output frame; its PNG buffer is reused across calls
+ * @return 1 on success, 0 on failure
+ */
+int render_display_frame(const struct Config *config,
+                         const monitor_sensor_data_t *data,
+                         DisplayFrame *frame);
+
+/**
+ * @brief Check whether a display uploads its circle rotation as animation.
+ * @details True for circle mode with display.circle_animation, unless file
+ * uploads are configured or CoolerControl rejected an animation since the
+ * last reset_frame_cache(). Thread-safe.
+ */
+int is_circle_animated(const struct Config *config);
+
+/**
+ * @brief Upload a rendered frame to the LCD device.
+ * @details Uses the in-memory or file upload path (see display.upload_mode)
+ * and records the frame for deduplication on success.
+ * @param config Configuration with upload mode and daemon address
+ * @param frame Frame produced by render_display_frame()
+ * @return 1 on success or if the frame was already uploaded, 0 on failure
+ */
+int upload_display_frame(const struct Config *config, const DisplayFrame *frame);
+
+/**
+ * @brief Render one frame to a PNG file without uploading it.
+ * @details Used by --preview; the LCD and the image_coolerdash file are not
+ * touched.
+ * @param config Display configuration
+ * @param data Sensor data to render
+ * @param output_path PNG file to write
+ * @param png_size Optional output: encoded size in bytes
+ * @return 1 on success, 0 on failure
+ */
+int render_preview_image(const struct Config *config,
+                         const monitor_sensor_data_t *data,
+                         const char *output_path, size_t *png_size);
+
+/**
+ * @brief Mix a block of bytes into a static layer key.
+ */
+uint64_t hash_layer_key(uint64_t hash, const void *data, size_t size);
+
+/**
+ * @brief Mix a string into a static layer key.
+ */
+uint64_t hash_layer_key_string(uint64_t hash, const char *text);
+
+/**
+ * @brief Start redrawing a static layer if its key changed.
+ * @details The background image file state is mixed into the key. Returns a
+ * context for the new layer surface when it must be redrawn; the caller draws
+ * the static content and calls end_static_layer(). Returns NULL if the cached
+ * layer is still valid or the surface could not be created.
+ * @param config Configuration with display dimensions
+ * @param layer Static layer to validate
+ * @param key Renderer-specific layer key
+ * @return Cairo context to draw into, or NULL
+ */
+cairo_t *begin_static_layer(const struct Config *config, StaticLayer *layer,
+                            uint64_t key);
+
+/**
+ * @brief Finish drawing a static layer and destroy its context.
+ */
+void end_static_layer(StaticLayer *layer, cairo_t *layer_cr);
+
+/**
+ * @brief Copy a cached static layer onto the frame.
+ * @return 1 if painted, 0 if no layer surface is available
+ */
+int paint_static_layer(cairo_t *cr, const StaticLayer *layer);
+
+/**
+ * @brief Release a static layer surface.
+ */
+void release_static_layer(StaticLayer *layer);
+
 /**
  * @brief Convert color component from 0-255 to cairo 0.0-1.0 range.
  */
@@ -237,7 +495,9 @@ void calculate_text_lane_bounds(const struct Config *config,
  * @brief Paint display background from optional PNG image or fallback color.
  * @details If a PNG background path is configured and readable, the image is
  * scaled to the current display size and painted first. Otherwise the
- * configured background color is used.
+ * configured background color is used. The composited background is cached
+ * until the file, fit mode, display size or overlay changes, or
+ * reset_display_state() is called.
  */
 void paint_display_background(cairo_t *cr, const struct Config *config);
 
@@ -256,6 +516,15 @@ int calculate_temp_fill_width(float temp_value, int max_width, float max_temp);
 void draw_rounded_rectangle_path(cairo_t *cr, int x, int y, int width,
                                  int height, double radius);
 
+/**
+ * @brief Draw the history sparkline of a slot inside its bar.
+ * @details No-op unless layout.sparkline is enabled and the slot has at least
+ * two samples.
+ */
+void draw_slot_sparkline(cairo_t *cr, const struct Config *config,
+                         const char *slot_value, int x, int y, int width,
+                         int height, double radius);
+
 /**
  * @brief Draw degree symbol at calculated position with proper font scaling.
  */
@@ -273,6 +542,18 @@ void draw_degree_symbol(cairo_t *cr, double x, double y,
  */
 int slot_is_active(const char *slot_value);
 
+/**
+ * @brief Get the render style of a sensor slot.
+ * @details Slots of the config (config->sensor_slot_N) use the style compiled
+ * into the layout plan; other slot values are resolved into scratch.
+ * @param config Configuration with sensor configs
+ * @param slot_value Slot configuration value
+ * @param scratch Storage used if the style is not compiled
+ * @return Style (never NULL)
+ */
+const SlotStyle *get_slot_style(const struct Config *config,
+                                const char *slot_value, SlotStyle *scratch);
+
 /**
  * @brief Get sensor value for a slot.
  * @param data Sensor data collection
@@ -292,6 +573,16 @@ const char *get_slot_label(const struct Config *config,
                            const monitor_sensor_data_t *data,
                            const char *slot_value);
 
+/**
+ * @brief Get the threshold band of a sensor slot value.
+ * @param config Configuration with sensor threshold configs
+ * @param slot_value Slot configuration value
+ * @param value Current sensor value
+ * @return 0..3 (below threshold_1 .. above threshold_3), -1 without thresholds
+ */
+int get_slot_threshold_band(const struct Config *config, const char *slot_value,
+                            float value);
+
 /**
  * @brief Get bar color for a sensor slot based on value.
  * @param config Configuration with sensor threshold configs
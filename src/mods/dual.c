@@ -16,7 +16,6 @@
 // cppcheck-suppress-begin missingIncludeSystem
 #include <cairo/cairo.h>
 #include <math.h>
-#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 // cppcheck-suppress-end missingIncludeSystem
@@ -24,37 +23,26 @@
 // Include project headers
 #include "../device/config.h"
 #include "../srv/cc_conf.h"
-#include "../srv/cc_main.h"
 #include "../srv/cc_sensor.h"
 #include "display.h"
+#include "history.h"
+#include "text.h"
 #include "dual.h"
 
 /**
  * @brief Forward declarations for internal display rendering functions.
  */
-static void draw_temperature_displays(cairo_t *cr,
-                                      const monitor_sensor_data_t *data,
-                                      const struct Config *config,
-                                      const ScalingParams *params);
-static void draw_temperature_bars(cairo_t *cr,
-                                  const monitor_sensor_data_t *data,
-                                  const struct Config *config,
-                                  const ScalingParams *params);
-static void draw_single_temperature_bar_slot(cairo_t *cr,
-                                             const struct Config *config,
-                                             const ScalingParams *params,
-                                             const char *slot_value,
-                                             float temp_value, int bar_x, int bar_y,
-                                             int bar_width, int bar_height);
-static void draw_labels(cairo_t *cr, const struct Config *config,
-                        const monitor_sensor_data_t *data,
-                        const ScalingParams *params);
 static void render_display_content(cairo_t *cr, const struct Config *config,
                                    const monitor_sensor_data_t *data,
-                                   const ScalingParams *params);
+                                   const LayoutPlan *plan, int retained);
 
+/**
+ * @brief Dual mode geometry derived from the layout plan.
+ * @details Computed once per plan generation; renderers only read it.
+ */
 typedef struct
 {
+    int valid;
     int up_active;
     int down_active;
     int bar_x;
@@ -69,15 +57,32 @@ typedef struct
     double top_value_box_height;
     double bottom_value_box_y;
     double bottom_value_box_height;
+    double top_lane_x;
+    double top_lane_width;
+    double bottom_lane_x;
+    double bottom_lane_width;
+    const char *label_up;
+    const char *label_down;
+    double label_x;
+    double up_label_gap;
+    double down_label_gap;
+    double label_offset_y;
+    double label_font_size;
+    double min_label_font_size;
 } DualLayout;
 
+// Cached geometry per display and the plan generation it was derived from
+static DualLayout dual_layouts[MAX_LCD_DISPLAYS] = {0};
+static unsigned int dual_layout_generations[MAX_LCD_DISPLAYS] = {0};
+
 static int calculate_dual_layout(const struct Config *config,
-                                 const ScalingParams *params,
-                                 DualLayout *layout)
+                                 const LayoutPlan *plan, DualLayout *layout)
 {
-    if (!config || !params || !layout)
+    if (!config || !plan || !layout)
         return 0;
 
+    const ScalingParams *params = &plan->params;
+
     memset(layout, 0, sizeof(*layout));
 
     layout->effective_bar_width = params->safe_bar_width;
@@ -114,15 +119,16 @@ static int calculate_dual_layout(const struct Config *config,
     layout->label_spacing = get_effective_label_spacing(config, params);
     const double value_bar_gap = layout->label_spacing * 0.05;
 
-    const SensorConfig *sc_up = get_sensor_config(config, config->sensor_slot_1);
-    const SensorConfig *sc_down = get_sensor_config(config, config->sensor_slot_3);
+    // Styles live in the plan, so the label pointers stay valid with it
+    const SlotStyle *style_up = &plan->slot_styles[0];
+    const SlotStyle *style_down = &plan->slot_styles[2];
     const double dual_avail_height =
         config->display_height - params->margin_top - params->margin_bottom;
-    const double gap_above_top = (sc_up && sc_up->value_to_bar_gap > 0.0f)
-                                     ? dual_avail_height * (sc_up->value_to_bar_gap / 100.0)
+    const double gap_above_top = (style_up->value_to_bar_gap > 0.0f)
+                                     ? dual_avail_height * (style_up->value_to_bar_gap / 100.0)
                                      : value_bar_gap;
-    const double gap_below_bottom = (sc_down && sc_down->value_to_bar_gap > 0.0f)
-                                        ? dual_avail_height * (sc_down->value_to_bar_gap / 100.0)
+    const double gap_below_bottom = (style_down->value_to_bar_gap > 0.0f)
+                                        ? dual_avail_height * (style_down->value_to_bar_gap / 100.0)
                                         : value_bar_gap;
 
     layout->top_value_box_y = params->margin_top;
@@ -133,6 +139,50 @@ static int calculate_dual_layout(const struct Config *config,
     layout->bottom_value_box_height =
         fmax(0.0, config->display_height - params->margin_bottom - layout->bottom_value_box_y);
 
+    // Value lanes (narrowest chord on circular displays)
+    layout->top_lane_x = layout->bar_x;
+    layout->top_lane_width = layout->effective_bar_width;
+    if (layout->up_active && layout->top_value_box_height > 0.0)
+        calculate_text_lane_bounds(config, params, layout->top_value_box_y,
+                                   layout->top_value_box_height, 0,
+                                   layout->bar_x, layout->effective_bar_width,
+                                   &layout->top_lane_x, &layout->top_lane_width);
+    layout->bottom_lane_x = layout->bar_x;
+    layout->bottom_lane_width = layout->effective_bar_width;
+    if (layout->down_active && layout->bottom_value_box_height > 0.0)
+        calculate_text_lane_bounds(config, params, layout->bottom_value_box_y,
+                                   layout->bottom_value_box_height, 1,
+                                   layout->bar_x, layout->effective_bar_width,
+                                   &layout->bottom_lane_x,
+                                   &layout->bottom_lane_width);
+
+    /* Dual mode: use custom label if set, otherwise always "CPU" / "GPU" */
+    layout->label_up = (style_up->label[0] != '\0') ? style_up->label : "CPU";
+    layout->label_down = (style_down->label[0] != '\0') ? style_down->label : "GPU";
+
+    // Labels: Configurable distance from left screen edge (default: 1%)
+    const double left_margin_factor =
+        (config->layout_label_margin_left > 0)
+            ? (config->layout_label_margin_left / 100.0)
+            : 0.01;
+    layout->label_x = params->safe_content_margin +
+                      (layout->effective_bar_width * left_margin_factor) +
+                      get_scaled_label_offset_x(config, params);
+    layout->up_label_gap = (style_up->label_to_bar_gap > 0.0f)
+                               ? dual_avail_height * (style_up->label_to_bar_gap / 100.0)
+                               : layout->label_spacing;
+    layout->down_label_gap = (style_down->label_to_bar_gap > 0.0f)
+                                 ? dual_avail_height * (style_down->label_to_bar_gap / 100.0)
+                                 : layout->label_spacing;
+    layout->label_offset_y = get_scaled_label_offset_y(config, params);
+    layout->label_font_size = get_preferred_label_font_size(config, params);
+    layout->min_label_font_size =
+        (config->font_size_labels > 0.0f)
+            ? fmax(10.0, scale_value_avg(params,
+                                         (double)config->font_size_labels) *
+                             0.60)
+            : fmax(10.0, scale_value_avg(params, 10.0));
+
     if (verbose_logging)
     {
         log_message(
@@ -150,88 +200,224 @@ static int calculate_dual_layout(const struct Config *config,
 }
 
 /**
- * @brief Draw temperature displays for up and down slots.
+ * @brief Get dual geometry for the current layout plan.
+ * @return Layout, or NULL if no slot is active
  */
-static void draw_temperature_displays(cairo_t *cr,
-                                      const monitor_sensor_data_t *data,
-                                      const struct Config *config,
-                                      const ScalingParams *params)
+static const DualLayout *get_dual_layout(const struct Config *config,
+                                         const LayoutPlan *plan)
 {
-    if (!cr || !data || !config || !params)
-        return;
+    const int index = get_display_state_index(config);
+    DualLayout *layout = &dual_layouts[index];
+    if (dual_layout_generations[index] != plan->generation)
+    {
+        const int valid = calculate_dual_layout(config, plan, layout);
+        layout->valid = valid;
+        dual_layout_generations[index] = plan->generation;
+    }
 
-    DualLayout layout = {0};
-    if (!calculate_dual_layout(config, params, &layout))
-        return;
+    return layout->valid ? layout : NULL;
+}
 
+/**
+ * @brief Fitted label placement for one dual mode slot.
+ */
+typedef struct
+{
+    const char *text;
+    double x;
+    double y;
+    double font_size;
+} DualLabel;
+
+// Retained background, bar backgrounds and labels per display
+static StaticLayer dual_static_layers[MAX_LCD_DISPLAYS] = {0};
+
+/**
+ * @brief What the frame canvas shows for one dual mode slot.
+ */
+typedef struct
+{
+    uint64_t key;         // Value text, fill, color and sparkline state
+    DirtyRect bar_rect;   // Bar including its border
+    DirtyRect value_rect; // Rendered value block
+} DualSlotFrame;
+
+/**
+ * @brief Last frame drawn on a display's canvas (dirty rectangle redraw).
+ */
+typedef struct
+{
+    int valid;
+    uint64_t layer_key; // Static layer the frame was composed on
+    DualSlotFrame slots[2];
+} DualFrame;
+
+static DualFrame dual_frames[MAX_LCD_DISPLAYS] = {0};
+
+/**
+ * @brief Resets dual mode state for config reload (SIGHUP).
+ * @details Releases the cached static layer and derived geometry.
+ */
+void reset_dual_state(void)
+{
+    for (int i = 0; i < MAX_LCD_DISPLAYS; i++)
+        release_static_layer(&dual_static_layers[i]);
+    memset(dual_layout_generations, 0, sizeof(dual_layout_generations));
+    memset(dual_frames, 0, sizeof(dual_frames));
+}
+
+/**
+ * @brief Measure or draw sensor values for up and down slots.
+ * @details With draw_output=0 only the value blocks are measured, which the
+ * label fitting needs before the static layer can be validated.
+ */
+static void layout_slot_values(cairo_t *cr, const monitor_sensor_data_t *data,
+                               const struct Config *config,
+                               const ScalingParams *params,
+                               const DualLayout *layout, int draw_output,
+                               SlotValueLayout *up_layout,
+                               SlotValueLayout *down_layout)
+{
     const char *slot_up = config->sensor_slot_1;
     const char *slot_down = config->sensor_slot_3;
 
-    float temp_up = get_slot_temperature(data, slot_up);
-    float temp_down = get_slot_temperature(data, slot_down);
+    memset(up_layout, 0, sizeof(*up_layout));
+    memset(down_layout, 0, sizeof(*down_layout));
 
-    if (layout.up_active && layout.top_value_box_height > 0.0)
-    {
-        double safe_x = layout.bar_x;
-        double safe_width = layout.effective_bar_width;
-        calculate_text_lane_bounds(config, params, layout.top_value_box_y,
-                                   layout.top_value_box_height, 0,
-                                   layout.bar_x,
-                                   layout.effective_bar_width, &safe_x,
-                                   &safe_width);
-        SlotValueLayout up_layout;
+    if (layout->up_active && layout->top_value_box_height > 0.0)
         layout_and_render_slot_value(cr, data, config, params, slot_up,
-                                     temp_up, safe_x,
-                                     layout.top_value_box_y,
-                                     safe_width,
-                                     layout.top_value_box_height, 0, 1,
-                                     &up_layout);
+                                     get_slot_temperature(data, slot_up),
+                                     layout->top_lane_x, layout->top_value_box_y,
+                                     layout->top_lane_width,
+                                     layout->top_value_box_height, 0,
+                                     draw_output, up_layout);
+
+    if (layout->down_active && layout->bottom_value_box_height > 0.0)
+        layout_and_render_slot_value(cr, data, config, params, slot_down,
+                                     get_slot_temperature(data, slot_down),
+                                     layout->bottom_lane_x,
+                                     layout->bottom_value_box_y,
+                                     layout->bottom_lane_width,
+                                     layout->bottom_value_box_height, 1,
+                                     draw_output, down_layout);
+}
+
+/**
+ * @brief Shrink a label font until the label fits left of the value block.
+ * @return Fitted font size; font_ext holds the extents at that size
+ */
+static double fit_label_font_size(cairo_t *cr, const ScalingParams *params,
+                                  const DualLayout *layout,
+                                  const SlotValueLayout *value_layout,
+                                  const char *label,
+                                  cairo_font_extents_t *font_ext)
+{
+    double label_font_size = layout->label_font_size;
+    const double safe_right = value_layout->active
+                                  ? (value_layout->block_left - scale_value_avg(params, 8.0))
+                                  : (layout->bar_x + layout->effective_bar_width);
+    const double available_width = fmax(8.0, safe_right - layout->label_x);
+    cairo_text_extents_t label_ext;
+
+    while (1)
+    {
+        cairo_set_font_size(cr, label_font_size);
+        measure_font(cr, font_ext);
+        measure_text(cr, label, &label_ext);
+
+        if (fmax(label_ext.x_advance, label_ext.width) <= available_width ||
+            label_font_size <= layout->min_label_font_size)
+            break;
+
+        label_font_size *= 0.92;
+        if (label_font_size < layout->min_label_font_size)
+            label_font_size = layout->min_label_font_size;
     }
 
-    if (layout.down_active && layout.bottom_value_box_height > 0.0)
+    return label_font_size;
+}
+
+/**
+ * @brief Fit label size and position for up and down slots.
+ * @details Labels only depend on the value block when they would overlap it,
+ * so the fitted result is stable across most frames.
+ */
+static void fit_labels(cairo_t *cr, const ScalingParams *params,
+                       const DualLayout *layout,
+                       const SlotValueLayout *up_layout,
+                       const SlotValueLayout *down_layout,
+                       DualLabel *up_label, DualLabel *down_label)
+{
+    memset(up_label, 0, sizeof(*up_label));
+    memset(down_label, 0, sizeof(*down_label));
+
+    cairo_font_extents_t font_ext;
+
+    // Upper slot label (if active)
+    if (layout->up_active)
     {
-        double safe_x = layout.bar_x;
-        double safe_width = layout.effective_bar_width;
-        calculate_text_lane_bounds(config, params, layout.bottom_value_box_y,
-                                   layout.bottom_value_box_height,
-                                   1,
-                                   layout.bar_x, layout.effective_bar_width,
-                                   &safe_x, &safe_width);
-        SlotValueLayout down_layout;
-        layout_and_render_slot_value(cr, data, config, params, slot_down,
-                                     temp_down, safe_x,
-                                     layout.bottom_value_box_y,
-                                     safe_width,
-                                     layout.bottom_value_box_height, 1, 1,
-                                     &down_layout);
+        up_label->font_size = fit_label_font_size(
+            cr, params, layout, up_layout, layout->label_up, &font_ext);
+        up_label->text = layout->label_up;
+        up_label->x = layout->label_x;
+        up_label->y = layout->up_bar_y - layout->up_label_gap -
+                      font_ext.descent + layout->label_offset_y;
+    }
+
+    // Lower slot label (if active)
+    if (layout->down_active)
+    {
+        down_label->font_size = fit_label_font_size(
+            cr, params, layout, down_layout, layout->label_down, &font_ext);
+        down_label->text = layout->label_down;
+        down_label->x = layout->label_x;
+        down_label->y = layout->down_bar_y + layout->bar_height_down +
+                        layout->down_label_gap + font_ext.ascent +
+                        layout->label_offset_y;
     }
 }
 
 /**
- * @brief Draw a single temperature bar with background, fill, and border.
+ * @brief Draw a fitted label.
  */
-static void draw_single_temperature_bar_slot(cairo_t *cr,
-                                             const struct Config *config,
-                                             const ScalingParams *params,
-                                             const char *slot_value,
-                                             float temp_value, int bar_x, int bar_y,
-                                             int bar_width, int bar_height)
+static void draw_label(cairo_t *cr, const DualLabel *label)
 {
-    if (!cr || !config || !params)
+    if (!label->text)
         return;
 
+    cairo_set_font_size(cr, label->font_size);
+    cairo_move_to(cr, label->x, label->y);
+    cairo_show_text(cr, label->text);
+}
+
+/**
+ * @brief Draw the static part of a bar (rounded background).
+ */
+static void draw_bar_background(cairo_t *cr, const struct Config *config,
+                                const ScalingParams *params, int bar_x,
+                                int bar_y, int bar_width, int bar_height)
+{
+    set_cairo_color_alpha(cr, &config->layout_bar_color_background,
+                          config->layout_bar_opacity);
+    draw_rounded_rectangle_path(cr, bar_x, bar_y, bar_width,
+                                bar_height, params->corner_radius);
+    cairo_fill(cr);
+}
+
+/**
+ * @brief Draw the value-dependent part of a bar (fill and border on top).
+ */
+static void draw_bar_fill(cairo_t *cr, const struct Config *config,
+                          const LayoutPlan *plan, const char *slot_value,
+                          float temp_value, int bar_x, int bar_y,
+                          int bar_width, int bar_height)
+{
     // Use slot-specific max scale and color
     const float max_temp = get_slot_max_scale(config, slot_value);
     const int fill_width =
         calculate_temp_fill_width(temp_value, bar_width, max_temp);
     const double bar_alpha = config->layout_bar_opacity;
 
-    // Background
-    set_cairo_color_alpha(cr, &config->layout_bar_color_background, bar_alpha);
-    draw_rounded_rectangle_path(cr, bar_x, bar_y, bar_width,
-                                bar_height, params->corner_radius);
-    cairo_fill(cr);
-
     // Fill
     if (fill_width > 0)
     {
@@ -241,370 +427,300 @@ static void draw_single_temperature_bar_slot(cairo_t *cr,
         if (fill_width >= 16)
             draw_rounded_rectangle_path(cr, bar_x, bar_y, fill_width,
                                         bar_height,
-                                        params->corner_radius);
+                                        plan->params.corner_radius);
         else
             cairo_rectangle(cr, bar_x, bar_y, fill_width, bar_height);
 
         cairo_fill(cr);
     }
 
-    // Border (only if enabled and thickness > 0)
+    draw_slot_sparkline(cr, config, slot_value, bar_x, bar_y, bar_width,
+                        bar_height, plan->params.corner_radius);
+
+    // Border (only if enabled and thickness > 0), stroked over the fill
     if (config->layout_bar_border_enabled && config->layout_bar_border > 0.0f)
     {
-        cairo_set_line_width(cr, get_scaled_bar_border_width(config, params));
+        cairo_set_line_width(cr, plan->bar_border_width);
         set_cairo_color_alpha(cr, &config->layout_bar_color_border, bar_alpha);
         draw_rounded_rectangle_path(cr, bar_x, bar_y, bar_width,
-                                    bar_height, params->corner_radius);
+                                    bar_height, plan->params.corner_radius);
         cairo_stroke(cr);
     }
 }
 
 /**
- * @brief Draw temperature bars for up and down slots.
+ * @brief Draw everything that does not depend on sensor values.
+ * @details Background, bar backgrounds and labels.
+ */
+static void draw_static_content(cairo_t *cr, const struct Config *config,
+                                const ScalingParams *params,
+                                const DualLayout *layout,
+                                const DualLabel *up_label,
+                                const DualLabel *down_label)
+{
+    paint_display_background(cr, config);
+
+    if (layout->up_active)
+        draw_bar_background(cr, config, params, layout->bar_x, layout->up_bar_y,
+                            layout->effective_bar_width, layout->bar_height_up);
+    if (layout->down_active)
+        draw_bar_background(cr, config, params, layout->bar_x,
+                            layout->down_bar_y, layout->effective_bar_width,
+                            layout->bar_height_down);
+
+    select_text_font(cr, config, TEXT_WEIGHT_BOLD);
+    set_cairo_color(cr, &config->font_color_label);
+    draw_label(cr, up_label);
+    draw_label(cr, down_label);
+}
+
+/**
+ * @brief Draw bar fills for up and down slots.
  */
 static void draw_temperature_bars(cairo_t *cr,
                                   const monitor_sensor_data_t *data,
                                   const struct Config *config,
-                                  const ScalingParams *params)
+                                  const LayoutPlan *plan,
+                                  const DualLayout *layout)
 {
-    if (!cr || !data || !config || !params)
-        return;
-
-    DualLayout layout = {0};
-    if (!calculate_dual_layout(config, params, &layout))
-        return;
-
     const char *slot_up = config->sensor_slot_1;
     const char *slot_down = config->sensor_slot_3;
 
-    if (layout.up_active)
-    {
-        float temp_up = get_slot_temperature(data, slot_up);
-        draw_single_temperature_bar_slot(cr, config, params, slot_up, temp_up,
-                                         layout.bar_x, layout.up_bar_y,
-                                         layout.effective_bar_width,
-                                         layout.bar_height_up);
-    }
+    if (layout->up_active)
+        draw_bar_fill(cr, config, plan, slot_up,
+                      get_slot_temperature(data, slot_up), layout->bar_x,
+                      layout->up_bar_y, layout->effective_bar_width,
+                      layout->bar_height_up);
+
+    if (layout->down_active)
+        draw_bar_fill(cr, config, plan, slot_down,
+                      get_slot_temperature(data, slot_down), layout->bar_x,
+                      layout->down_bar_y, layout->effective_bar_width,
+                      layout->bar_height_down);
+}
+
+/**
+ * @brief Build the static layer key from geometry and fitted labels.
+ */
+static uint64_t static_layer_key(const ScalingParams *params,
+                                 const DualLayout *layout,
+                                 const DualLabel *up_label,
+                                 const DualLabel *down_label)
+{
+    uint64_t key = STATIC_LAYER_KEY_SEED;
+    key = hash_layer_key(key, params, sizeof(*params));
+    key = hash_layer_key(key, layout, sizeof(*layout));
 
-    if (layout.down_active)
+    const DualLabel *labels[2] = {up_label, down_label};
+    for (int i = 0; i < 2; i++)
     {
-        float temp_down = get_slot_temperature(data, slot_down);
-        draw_single_temperature_bar_slot(cr, config, params, slot_down, temp_down,
-                                         layout.bar_x, layout.down_bar_y,
-                                         layout.effective_bar_width,
-                                         layout.bar_height_down);
+        key = hash_layer_key_string(key, labels[i]->text);
+        key = hash_layer_key(key, &labels[i]->x, sizeof(labels[i]->x));
+        key = hash_layer_key(key, &labels[i]->y, sizeof(labels[i]->y));
+        key = hash_layer_key(key, &labels[i]->font_size,
+                             sizeof(labels[i]->font_size));
     }
+
+    return key;
 }
 
 /**
- * @brief Draw labels for up and down slots.
+ * @brief Describe what a slot contributes to the frame.
+ * @details The key covers everything drawn per frame (value text, fill width
+ * and color, sparkline samples, value placement), so equal keys mean equal
+ * pixels on an unchanged static layer.
  */
-static void draw_labels(cairo_t *cr, const struct Config *config,
-                        const monitor_sensor_data_t *data,
-                        const ScalingParams *params)
+static void describe_slot_frame(const monitor_sensor_data_t *data,
+                                const struct Config *config,
+                                const LayoutPlan *plan, const char *slot_value,
+                                int active, int bar_y, int bar_height,
+                                const DualLayout *layout,
+                                const SlotValueLayout *value_layout,
+                                DualSlotFrame *frame)
 {
-    if (!cr || !config || !params)
+    memset(frame, 0, sizeof(*frame));
+    if (!active)
         return;
 
-    DualLayout layout = {0};
-    if (!calculate_dual_layout(config, params, &layout))
-        return;
-
-    const char *slot_up = config->sensor_slot_1;
-    const char *slot_down = config->sensor_slot_3;
-
-    const double dual_avail_height =
-        config->display_height - params->margin_top - params->margin_bottom;
+    const float temp_value = get_slot_temperature(data, slot_value);
+    char text[32];
+    format_slot_value_text(text, sizeof(text), data, slot_value, temp_value);
+    const int fill_width = calculate_temp_fill_width(
+        temp_value, layout->effective_bar_width,
+        get_slot_max_scale(config, slot_value));
+    const Color fill_color = get_slot_bar_color(config, slot_value, temp_value);
+
+    uint64_t key = STATIC_LAYER_KEY_SEED;
+    key = hash_layer_key_string(key, text);
+    key = hash_layer_key(key, &fill_width, sizeof(fill_width));
+    key = hash_layer_key(key, &fill_color, sizeof(fill_color));
+    key = hash_layer_key(key, value_layout, sizeof(*value_layout));
+
+    const SlotHistory *history = get_slot_history(config, slot_value);
+    if (history)
+        key = hash_layer_key(key, &history->next_seq,
+                             sizeof(history->next_seq));
+    frame->key = key;
+
+    // Border strokes straddle the bar edge; one extra pixel covers AA
+    const double bar_margin = plan->bar_border_width / 2.0 + 1.0;
+    frame->bar_rect = make_dirty_rect(
+        layout->bar_x, bar_y, layout->bar_x + layout->effective_bar_width,
+        bar_y + bar_height, bar_margin);
+
+    if (value_layout->active)
+        frame->value_rect = make_dirty_rect(
+            value_layout->block_left, value_layout->block_top,
+            value_layout->block_right, value_layout->block_bottom, 2.0);
+}
 
-    /* Dual mode: use custom label if set, otherwise always "CPU" / "GPU" */
-    const SensorConfig *sc_lbl_up = get_sensor_config(config, slot_up);
-    const SensorConfig *sc_lbl_down = get_sensor_config(config, slot_down);
-    const char *label_up = (sc_lbl_up && sc_lbl_up->label[0] != '\0')
-                               ? sc_lbl_up->label
-                               : "CPU";
-    const char *label_down = (sc_lbl_down && sc_lbl_down->label[0] != '\0')
-                                 ? sc_lbl_down->label
-                                 : "GPU";
-
-    SlotValueLayout up_layout = {0};
-    SlotValueLayout down_layout = {0};
-    if (layout.up_active && layout.top_value_box_height > 0.0)
+/**
+ * @brief Collect the regions of slots whose content changed.
+ * @details A changed value clears its old and new block, so shrinking text
+ * leaves no stale glyphs behind.
+ * @return Number of rectangles written (at most 6)
+ */
+static int collect_dirty_rects(const DualFrame *previous,
+                               const DualSlotFrame *next, DirtyRect *rects)
+{
+    int count = 0;
+    for (int i = 0; i < 2; i++)
     {
-        double safe_x = layout.bar_x;
-        double safe_width = layout.effective_bar_width;
-        calculate_text_lane_bounds(config, params, layout.top_value_box_y,
-                                   layout.top_value_box_height, 0,
-                                   layout.bar_x,
-                                   layout.effective_bar_width, &safe_x,
-                                   &safe_width);
-        layout_and_render_slot_value(cr, data, config, params, slot_up,
-                                     get_slot_temperature(data, slot_up),
-                                     safe_x, layout.top_value_box_y,
-                                     safe_width,
-                                     layout.top_value_box_height, 0, 0,
-                                     &up_layout);
+        if (next[i].key == previous->slots[i].key)
+            continue;
+        rects[count++] = next[i].bar_rect;
+        rects[count++] = previous->slots[i].value_rect;
+        rects[count++] = next[i].value_rect;
     }
-    if (layout.down_active && layout.bottom_value_box_height > 0.0)
+    return count;
+}
+
+/**
+ * @brief Render display content to cairo context.
+ * @details Geometry comes from the layout plan. The static layer is reused
+ * while geometry and labels are unchanged; each frame then only draws bar
+ * fills, borders and values. On a retained canvas over the same static layer
+ * only the bars and value blocks of changed slots are cleared and redrawn.
+ */
+static void render_display_content(cairo_t *cr, const struct Config *config,
+                                   const monitor_sensor_data_t *data,
+                                   const LayoutPlan *plan, int retained)
+{
+    const ScalingParams *params = &plan->params;
+    const DualLayout *layout = get_dual_layout(config, plan);
+    DualFrame *frame = &dual_frames[get_display_state_index(config)];
+    if (!layout)
     {
-        double safe_x = layout.bar_x;
-        double safe_width = layout.effective_bar_width;
-        calculate_text_lane_bounds(config, params, layout.bottom_value_box_y,
-                                   layout.bottom_value_box_height,
-                                   1,
-                                   layout.bar_x, layout.effective_bar_width,
-                                   &safe_x, &safe_width);
-        layout_and_render_slot_value(cr, data, config, params, slot_down,
-                                     get_slot_temperature(data, slot_down),
-                                     safe_x, layout.bottom_value_box_y,
-                                     safe_width,
-                                     layout.bottom_value_box_height, 1, 0,
-                                     &down_layout);
+        frame->valid = 0;
+        clear_frame_canvas(cr);
+        paint_display_background(cr, config);
+        return;
     }
 
-    // Labels: Configurable distance from left screen edge (default: 1%)
-    const double left_margin_factor =
-        (config->layout_label_margin_left > 0)
-            ? (config->layout_label_margin_left / 100.0)
-            : 0.01;
-    double label_x = params->safe_content_margin +
-                     (layout.effective_bar_width * left_margin_factor);
+    select_text_font(cr, config, TEXT_WEIGHT_BOLD);
 
-    // Apply user-defined X offset if set
-    label_x += get_scaled_label_offset_x(config, params);
+    SlotValueLayout up_value = {0};
+    SlotValueLayout down_value = {0};
+    layout_slot_values(cr, data, config, params, layout, 0, &up_value,
+                       &down_value);
 
-    cairo_font_extents_t font_ext;
-    cairo_font_extents(cr, &font_ext);
+    DualLabel up_label = {0};
+    DualLabel down_label = {0};
+    fit_labels(cr, params, layout, &up_value, &down_value, &up_label,
+               &down_label);
 
-    // Draw upper slot label (if active and has label)
-    if (layout.up_active && label_up)
+    StaticLayer *static_layer =
+        &dual_static_layers[get_display_state_index(config)];
+    cairo_t *layer_cr = begin_static_layer(
+        config, static_layer,
+        static_layer_key(params, layout, &up_label, &down_label));
+    if (layer_cr)
     {
-        double label_font_size = get_preferred_label_font_size(config, params);
-        const double min_label_font_size =
-            (config->font_size_labels > 0.0f)
-                ? fmax(10.0, scale_value_avg(params,
-                                             (double)config->font_size_labels) *
-                                 0.60)
-                : fmax(10.0, scale_value_avg(params, 10.0));
-        cairo_text_extents_t up_label_ext;
-        while (1)
-        {
-            cairo_set_font_size(cr, label_font_size);
-            cairo_font_extents(cr, &font_ext);
-            cairo_text_extents(cr, label_up, &up_label_ext);
-
-            const double up_safe_right = up_layout.active
-                                             ? (up_layout.block_left - scale_value_avg(params, 8.0))
-                                             : (layout.bar_x + layout.effective_bar_width);
-            const double up_available_width = fmax(8.0, up_safe_right - label_x);
-
-            if (fmax(up_label_ext.x_advance, up_label_ext.width) <= up_available_width ||
-                label_font_size <= min_label_font_size)
-                break;
-
-            label_font_size *= 0.92;
-            if (label_font_size < min_label_font_size)
-                label_font_size = min_label_font_size;
-        }
-
-        const SensorConfig *sc_up_lbl = get_sensor_config(config, slot_up);
-        const double up_label_gap = (sc_up_lbl && sc_up_lbl->label_to_bar_gap > 0.0f)
-                                        ? dual_avail_height * (sc_up_lbl->label_to_bar_gap / 100.0)
-                                        : layout.label_spacing;
-        double up_label_y = layout.up_bar_y - up_label_gap - font_ext.descent;
-        up_label_y += get_scaled_label_offset_y(config, params);
-
-        cairo_set_font_size(cr, label_font_size);
-        cairo_move_to(cr, label_x, up_label_y);
-        cairo_show_text(cr, label_up);
+        draw_static_content(layer_cr, config, params, layout, &up_label,
+                            &down_label);
+        end_static_layer(static_layer, layer_cr);
     }
 
-    // Draw lower slot label (if active and has label)
-    if (layout.down_active && label_down)
+    DualSlotFrame next[2];
+    describe_slot_frame(data, config, plan, config->sensor_slot_1,
+                        layout->up_active, layout->up_bar_y,
+                        layout->bar_height_up, layout, &up_value, &next[0]);
+    describe_slot_frame(data, config, plan, config->sensor_slot_3,
+                        layout->down_active, layout->down_bar_y,
+                        layout->bar_height_down, layout, &down_value,
+                        &next[1]);
+
+    // Partial redraw needs the previous pixels over the same static layer
+    const int partial = retained && frame->valid && static_layer->surface &&
+                        frame->layer_key == static_layer->key;
+    if (partial)
     {
-        double label_font_size = get_preferred_label_font_size(config, params);
-        const double min_label_font_size =
-            (config->font_size_labels > 0.0f)
-                ? fmax(10.0, scale_value_avg(params,
-                                             (double)config->font_size_labels) *
-                                 0.60)
-                : fmax(10.0, scale_value_avg(params, 10.0));
-        cairo_text_extents_t down_label_ext;
-        while (1)
-        {
-            cairo_set_font_size(cr, label_font_size);
-            cairo_font_extents(cr, &font_ext);
-            cairo_text_extents(cr, label_down, &down_label_ext);
-
-            const double down_safe_right = down_layout.active
-                                               ? (down_layout.block_left - scale_value_avg(params, 8.0))
-                                               : (layout.bar_x + layout.effective_bar_width);
-            const double down_available_width =
-                fmax(8.0, down_safe_right - label_x);
-
-            if (fmax(down_label_ext.x_advance, down_label_ext.width) <=
-                    down_available_width ||
-                label_font_size <= min_label_font_size)
-                break;
-
-            label_font_size *= 0.92;
-            if (label_font_size < min_label_font_size)
-                label_font_size = min_label_font_size;
-        }
-
-        const SensorConfig *sc_down_lbl = get_sensor_config(config, slot_down);
-        const double down_label_gap = (sc_down_lbl && sc_down_lbl->label_to_bar_gap > 0.0f)
-                                          ? dual_avail_height * (sc_down_lbl->label_to_bar_gap / 100.0)
-                                          : layout.label_spacing;
-        double down_label_y = layout.down_bar_y + layout.bar_height_down +
-                              down_label_gap + font_ext.ascent;
-        down_label_y += get_scaled_label_offset_y(config, params);
+        DirtyRect dirty[6];
+        const int dirty_count = collect_dirty_rects(frame, next, dirty);
+        if (dirty_count == 0)
+            return;
 
-        cairo_set_font_size(cr, label_font_size);
-        cairo_move_to(cr, label_x, down_label_y);
-        cairo_show_text(cr, label_down);
+        cairo_save(cr);
+        clip_dirty_rects(cr, dirty, dirty_count);
+    }
+    else if (retained)
+    {
+        clear_frame_canvas(cr);
     }
-}
 
-/**
- * @brief Render display content to cairo context.
- */
-static void render_display_content(cairo_t *cr, const struct Config *config,
-                                   const monitor_sensor_data_t *data,
-                                   const ScalingParams *params)
-{
-    paint_display_background(cr, config);
+    const int layered = paint_static_layer(cr, static_layer);
+    if (!layered)
+        draw_static_content(cr, config, params, layout, &up_label,
+                            &down_label);
 
-    draw_temperature_bars(cr, data, config, params);
+    draw_temperature_bars(cr, data, config, plan, layout);
 
-    cairo_select_font_face(cr, config->font_face, CAIRO_FONT_SLANT_NORMAL,
-                           CAIRO_FONT_WEIGHT_BOLD);
+    select_text_font(cr, config, TEXT_WEIGHT_BOLD);
     cairo_set_font_size(cr, config->font_size_temp);
     set_cairo_color(cr, &config->font_color_temp);
+    layout_slot_values(cr, data, config, params, layout, 1, &up_value,
+                       &down_value);
 
-    draw_temperature_displays(cr, data, config, params);
+    if (partial)
+        cairo_restore(cr);
 
-    cairo_set_font_size(cr, config->font_size_labels);
-    set_cairo_color(cr, &config->font_color_label);
-    draw_labels(cr, config, data, params);
+    frame->valid = layered;
+    frame->layer_key = static_layer->key;
+    memcpy(frame->slots, next, sizeof(frame->slots));
 }
 
 /**
- * @brief Display rendering - creates surface, renders content, saves PNG (Dual
- * mode - CPU+GPU).
+ * @brief Render the dual mode frame into the display's frame canvas.
+ * @details The returned surface belongs to the canvas and stays valid until
+ * the next frame of the same display.
  */
-static int render_dual_display(const struct Config *config,
-                               const monitor_sensor_data_t *data,
-                               const char *device_name)
+cairo_surface_t *render_dual_surface(const struct Config *config,
+                                     const monitor_sensor_data_t *data)
 {
     if (!data || !config)
     {
         log_message(LOG_ERROR, "Invalid parameters for render_display");
-        return 0;
+        return NULL;
     }
 
-    ScalingParams scaling_params;
-    calculate_scaling_params(config, &scaling_params, device_name);
-
-    // Log display shape detection
-    if (scaling_params.is_circular)
-    {
-        log_message(LOG_INFO,
-                    "Circular display detected (device: %s, inscribe factor: %.4f)",
-                    device_name ? device_name : "unknown",
-                    scaling_params.inscribe_factor);
-    }
-    else
-    {
-        log_message(
-            LOG_INFO,
-            "Rectangular display detected (device: %s, inscribe factor: %.4f)",
-            device_name ? device_name : "unknown", scaling_params.inscribe_factor);
-    }
+    const LayoutPlan *plan = get_layout_plan(config);
 
     cairo_surface_t *surface = NULL;
-    cairo_t *cr = create_cairo_context(config, &surface);
+    int retained = 0;
+    cairo_t *cr = begin_frame_canvas(config, dual_frames, &surface, &retained);
     if (!cr)
-        return 0;
+        return NULL;
 
-    render_display_content(cr, config, data, &scaling_params);
+    render_display_content(cr, config, data, plan, retained);
 
-    cairo_surface_flush(surface);
+    end_frame_canvas(cr);
     if (cairo_status(cr) != CAIRO_STATUS_SUCCESS)
     {
+        dual_frames[get_display_state_index(config)].valid = 0;
         log_message(LOG_ERROR, "Cairo drawing error: %s",
                     cairo_status_to_string(cairo_status(cr)));
-        cairo_destroy(cr);
-        cairo_surface_destroy(surface);
-        return 0;
+        return NULL;
     }
 
-    cairo_status_t write_status =
-        cairo_surface_write_to_png(surface, config->paths_image_coolerdash);
-    int success = (write_status == CAIRO_STATUS_SUCCESS);
-
-    if (!success)
-        log_message(LOG_ERROR, "Failed to write PNG image: %s",
-                    config->paths_image_coolerdash);
-
-    cairo_destroy(cr);
-    cairo_surface_destroy(surface);
-
-    return success;
-}
-
-/**
- * @brief Main dual mode entry point.
- * @details Collects sensor data, renders dual display using
- * render_dual_display(), and sends to LCD device.
- */
-void draw_dual_image(const struct Config *config)
-{
-    if (!config)
-    {
-        log_message(LOG_ERROR, "Invalid config parameter");
-        return;
-    }
-
-    // Get sensor data
-    monitor_sensor_data_t sensor_data = {0};
-    if (!get_sensor_monitor_data(config, &sensor_data))
-    {
-        log_message(LOG_WARNING, "Failed to retrieve sensor data");
-        return;
-    }
-
-    // Get LCD device info
-    char device_uid[128] = {0};
-    char device_name[256] = {0};
-    int screen_width = 0, screen_height = 0;
-
-    const bool device_available =
-        get_cached_lcd_device_data(config, device_uid, sizeof(device_uid),
-                                   device_name, sizeof(device_name),
-                                   &screen_width, &screen_height);
-
-    // Render dual display with device name for circular display detection
-    if (!render_dual_display(config, &sensor_data, device_name))
-    {
-        log_message(LOG_ERROR, "Dual display rendering failed");
-        return;
-    }
-
-    // Send to LCD if available
-    if (is_session_initialized() && device_available && device_uid[0] != '\0')
-    {
-        const char *name =
-            (device_name[0] != '\0') ? device_name : "Unknown Device";
-        log_message(LOG_INFO, "Sending dual image to LCD: %s [%s]", name,
-                    device_uid);
-
-        // Send image to LCD device
-        send_image_to_lcd(config, config->paths_image_coolerdash, device_uid);
-
-        log_message(LOG_INFO, "Dual LCD image uploaded successfully");
-    }
-    else
-    {
-        log_message(LOG_WARNING, "Skipping dual LCD upload - device not available");
-    }
+    return surface;
 }
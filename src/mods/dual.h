@@ -18,6 +18,7 @@
 
 // Include necessary headers
 // cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
 #include <stddef.h>
 #include <stdint.h>
 // cppcheck-suppress-end missingIncludeSystem
@@ -29,11 +30,18 @@
 struct Config;
 
 /**
- * @brief Main dual mode entry point.
- * @details Collects sensor data, renders dual display using
- * render_dual_display(), and uploads to LCD. This is the high-level function
- * called by the dispatcher to show CPU+GPU simultaneously.
+ * @brief Render the dual mode frame (all slots simultaneously).
+ * @details Called by render_display_frame(), which hashes and encodes the
+ * surface. Draws into the display's long-lived frame canvas.
+ * @return Canvas surface (do not destroy), or NULL on failure
  */
-void draw_dual_image(const struct Config *config);
+cairo_surface_t *render_dual_surface(const struct Config *config,
+                                     const monitor_sensor_data_t *data);
+
+/**
+ * @brief Resets dual mode state for config reload (SIGHUP).
+ * @details Releases the cached static layer.
+ */
+void reset_dual_state(void);
 
 #endif // DUAL_H
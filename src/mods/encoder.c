@@ -0,0 +1,716 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief PNG and animated GIF encoder for LCD frames.
+ * @details Replaces cairo_surface_write_to_png() for uploads. The device
+ * backend re-encodes every frame anyway, so encoding speed matters more than
+ * output size: the zlib level is configurable and the filter is fixed. GIF
+ * frames are quantized per frame into a local color table, which keeps the
+ * flat colours of the layout exact.
+ */
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../device/config.h"
+#include "../srv/cc_main.h"
+#include "encoder.h"
+
+// PNG constants
+#define PNG_FILTER_NONE 0
+#define PNG_FILTER_UP 2
+#define PNG_COLOR_RGB 2
+#define PNG_COLOR_RGBA 6
+
+// Signature + IHDR chunk + IDAT chunk header/CRC + IEND chunk
+#define PNG_OVERHEAD_SIZE (8 + 25 + 12 + 12)
+
+// GIF constants: 5 bits per channel select a histogram bin
+#define GIF_MAX_COLORS 256
+#define GIF_BIN_BITS 5
+#define GIF_BIN_COUNT (1 << (3 * GIF_BIN_BITS))
+#define GIF_LZW_MAX_CODES 4096
+#define GIF_LZW_TABLE_SIZE (2 * GIF_LZW_MAX_CODES)
+#define GIF_BLOCK_SIZE 255
+
+/**
+ * @brief Persistent deflate stream and row scratch buffers.
+ * @details The stream is reset per frame and only re-initialised when the
+ * compression level changes.
+ */
+static struct
+{
+    z_stream stream;
+    int initialized;
+    int level;
+    unsigned char *rows;
+    size_t row_capacity;
+} encoder = {0};
+
+/**
+ * @brief GIF quantizer and LZW state, allocated on first use.
+ * @details bins holds count and RGB sums per histogram bin, order the
+ * non-empty bins by count, bin_index the palette entry of each bin. The LZW
+ * dictionary is an open-addressing table of (prefix << 8 | index) keys.
+ */
+static struct
+{
+    uint32_t *bins;
+    uint16_t *order;
+    unsigned char *bin_index;
+    unsigned char *indices;
+    size_t index_capacity;
+    int32_t *lzw_keys;
+    uint16_t *lzw_codes;
+    unsigned char block[GIF_BLOCK_SIZE];
+    int block_size;
+    uint32_t bits;
+    int bit_count;
+} gif = {0};
+
+/** @brief Store a 32-bit value in PNG (big-endian) byte order. */
+static void put_u32(unsigned char *dest, uint32_t value)
+{
+    dest[0] = (unsigned char)(value >> 24);
+    dest[1] = (unsigned char)(value >> 16);
+    dest[2] = (unsigned char)(value >> 8);
+    dest[3] = (unsigned char)value;
+}
+
+/**
+ * @brief Finish a chunk whose type and data are already in place.
+ * @details Writes the length before and the CRC after the chunk data.
+ * @return Number of bytes of the complete chunk
+ */
+static size_t finish_chunk(unsigned char *chunk, size_t data_length)
+{
+    put_u32(chunk, (uint32_t)data_length);
+    const uLong crc = crc32(crc32(0L, Z_NULL, 0), chunk + 4,
+                            (uInt)(data_length + 4));
+    put_u32(chunk + 8 + data_length, (uint32_t)crc);
+    return data_length + 12;
+}
+
+/** @brief Grow a buffer to at least the required capacity. */
+static int reserve_buffer(unsigned char **data, size_t *capacity,
+                          size_t required)
+{
+    if (required <= *capacity)
+        return 1;
+
+    unsigned char *ptr = realloc(*data, required);
+    if (!ptr)
+        return 0;
+
+    cc_count_allocation();
+    *data = ptr;
+    *capacity = required;
+    return 1;
+}
+
+/** @brief Prepare the deflate stream for a new frame. */
+static int prepare_stream(int level)
+{
+    if (encoder.initialized && encoder.level == level)
+        return deflateReset(&encoder.stream) == Z_OK;
+
+    if (encoder.initialized)
+    {
+        deflateEnd(&encoder.stream);
+        encoder.initialized = 0;
+    }
+
+    /* Run-length matching suits filtered flat-coloured rows */
+    const int strategy = (level == 1) ? Z_RLE : Z_DEFAULT_STRATEGY;
+
+    memset(&encoder.stream, 0, sizeof(encoder.stream));
+    if (deflateInit2(&encoder.stream, level, Z_DEFLATED, 15, 8, strategy) !=
+        Z_OK)
+        return 0;
+
+    cc_count_allocation();
+    encoder.initialized = 1;
+    encoder.level = level;
+    return 1;
+}
+
+/** @brief Check whether every pixel of an ARGB32 surface is opaque. */
+static int is_surface_opaque(const unsigned char *pixels, int width,
+                             int height, int stride)
+{
+    for (int y = 0; y < height; y++)
+    {
+        const uint32_t *row =
+            (const uint32_t *)(const void *)(pixels + (size_t)y * (size_t)stride);
+        for (int x = 0; x < width; x++)
+        {
+            if ((row[x] >> 24) != 0xff)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Convert one native-endian premultiplied row to PNG byte order.
+ * @details Alpha is dropped for opaque frames and un-premultiplied otherwise.
+ */
+static void convert_row(const uint32_t *src, int width, int opaque,
+                        unsigned char *dest)
+{
+    for (int x = 0; x < width; x++)
+    {
+        const uint32_t pixel = src[x];
+        unsigned int r = (pixel >> 16) & 0xff;
+        unsigned int g = (pixel >> 8) & 0xff;
+        unsigned int b = pixel & 0xff;
+
+        if (opaque)
+        {
+            dest[0] = (unsigned char)r;
+            dest[1] = (unsigned char)g;
+            dest[2] = (unsigned char)b;
+            dest += 3;
+            continue;
+        }
+
+        const unsigned int a = pixel >> 24;
+        if (a == 0)
+        {
+            r = g = b = 0;
+        }
+        else if (a != 0xff)
+        {
+            r = (r * 255 + a / 2) / a;
+            g = (g * 255 + a / 2) / a;
+            b = (b * 255 + a / 2) / a;
+        }
+        dest[0] = (unsigned char)r;
+        dest[1] = (unsigned char)g;
+        dest[2] = (unsigned char)b;
+        dest[3] = (unsigned char)a;
+        dest += 4;
+    }
+}
+
+/**
+ * @brief Encode an ARGB32 image surface as PNG.
+ */
+int encode_png_frame(cairo_surface_t *surface, int compression_level,
+                     png_buffer_t *out)
+{
+    if (!surface || !out ||
+        cairo_surface_get_type(surface) != CAIRO_SURFACE_TYPE_IMAGE)
+        return 0;
+
+    const cairo_format_t format = cairo_image_surface_get_format(surface);
+    const unsigned char *pixels = cairo_image_surface_get_data(surface);
+    const int width = cairo_image_surface_get_width(surface);
+    const int height = cairo_image_surface_get_height(surface);
+    const int stride = cairo_image_surface_get_stride(surface);
+    if ((format != CAIRO_FORMAT_ARGB32 && format != CAIRO_FORMAT_RGB24) ||
+        !pixels || width <= 0 || height <= 0)
+        return 0;
+
+    const int level = (compression_level < 0)   ? 0
+                      : (compression_level > 9) ? 9
+                                                : compression_level;
+    const int opaque = (format == CAIRO_FORMAT_RGB24) ||
+                       is_surface_opaque(pixels, width, height, stride);
+    const size_t row_bytes = (size_t)width * (opaque ? 3 : 4);
+
+    /* Scratch: previous row, current row, filter byte + filtered row */
+    if (!reserve_buffer(&encoder.rows, &encoder.row_capacity,
+                        row_bytes * 3 + 1) ||
+        !prepare_stream(level))
+    {
+        log_message(LOG_ERROR, "PNG encoder initialization failed");
+        return 0;
+    }
+
+    const uLong raw_size = (uLong)(row_bytes + 1) * (uLong)height;
+    const uLong idat_bound = deflateBound(&encoder.stream, raw_size);
+    if (!reserve_buffer(&out->data, &out->capacity,
+                        (size_t)idat_bound + PNG_OVERHEAD_SIZE))
+    {
+        log_message(LOG_ERROR, "PNG output buffer allocation failed");
+        return 0;
+    }
+
+    unsigned char *dest = out->data;
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G',
+                                               '\r', '\n', 0x1a, '\n'};
+    memcpy(dest, signature, sizeof(signature));
+    dest += sizeof(signature);
+
+    /* IHDR: 8-bit RGB(A), deflate, adaptive filtering, no interlace */
+    memcpy(dest + 4, "IHDR", 4);
+    put_u32(dest + 8, (uint32_t)width);
+    put_u32(dest + 12, (uint32_t)height);
+    dest[16] = 8;
+    dest[17] = opaque ? PNG_COLOR_RGB : PNG_COLOR_RGBA;
+    dest[18] = 0;
+    dest[19] = 0;
+    dest[20] = 0;
+    dest += finish_chunk(dest, 13);
+
+    unsigned char *idat = dest;
+    memcpy(idat + 4, "IDAT", 4);
+    encoder.stream.next_out = idat + 8;
+    encoder.stream.avail_out = (uInt)idat_bound;
+
+    /* Stored rows gain nothing from filtering */
+    const unsigned char filter = (level == 0) ? PNG_FILTER_NONE : PNG_FILTER_UP;
+    unsigned char *prev_row = encoder.rows;
+    unsigned char *cur_row = encoder.rows + row_bytes;
+    unsigned char *filtered = encoder.rows + row_bytes * 2;
+    memset(prev_row, 0, row_bytes);
+
+    for (int y = 0; y < height; y++)
+    {
+        const uint32_t *src =
+            (const uint32_t *)(const void *)(pixels + (size_t)y * (size_t)stride);
+        convert_row(src, width, opaque, cur_row);
+
+        filtered[0] = filter;
+        if (filter == PNG_FILTER_UP)
+        {
+            for (size_t i = 0; i < row_bytes; i++)
+                filtered[i + 1] = (unsigned char)(cur_row[i] - prev_row[i]);
+        }
+        else
+        {
+            memcpy(filtered + 1, cur_row, row_bytes);
+        }
+
+        encoder.stream.next_in = filtered;
+        encoder.stream.avail_in = (uInt)(row_bytes + 1);
+        const int flush = (y == height - 1) ? Z_FINISH : Z_NO_FLUSH;
+        const int ret = deflate(&encoder.stream, flush);
+        if (ret != (flush == Z_FINISH ? Z_STREAM_END : Z_OK) ||
+            encoder.stream.avail_in != 0)
+        {
+            log_message(LOG_ERROR, "PNG deflate failed: %d", ret);
+            return 0;
+        }
+
+        unsigned char *swap = prev_row;
+        prev_row = cur_row;
+        cur_row = swap;
+    }
+
+    const size_t idat_length = (size_t)idat_bound - encoder.stream.avail_out;
+    dest += finish_chunk(idat, idat_length);
+
+    memcpy(dest + 4, "IEND", 4);
+    dest += finish_chunk(dest, 0);
+
+    out->size = (size_t)(dest - out->data);
+    return 1;
+}
+
+// ============================================================================
+// Animated GIF
+// ============================================================================
+
+/** @brief Append bytes to an output buffer, growing it geometrically. */
+static int append_bytes(png_buffer_t *out, const void *bytes, size_t length)
+{
+    const size_t required = out->size + length;
+    if (required > out->capacity &&
+        !reserve_buffer(&out->data, &out->capacity,
+                        required > out->capacity * 2 ? required
+                                                     : out->capacity * 2))
+        return 0;
+
+    memcpy(out->data + out->size, bytes, length);
+    out->size = required;
+    return 1;
+}
+
+/** @brief Store a 16-bit value in GIF (little-endian) byte order. */
+static void put_u16_le(unsigned char *dest, unsigned int value)
+{
+    dest[0] = (unsigned char)value;
+    dest[1] = (unsigned char)(value >> 8);
+}
+
+/** @brief Allocate the quantizer and dictionary tables once. */
+static int prepare_gif_state(size_t pixel_count)
+{
+    if (!gif.lzw_codes)
+    {
+        if (!gif.bins)
+            gif.bins = malloc(sizeof(uint32_t) * 4 * GIF_BIN_COUNT);
+        if (!gif.order)
+            gif.order = malloc(sizeof(uint16_t) * GIF_BIN_COUNT);
+        if (!gif.bin_index)
+            gif.bin_index = malloc(GIF_BIN_COUNT);
+        if (!gif.lzw_keys)
+            gif.lzw_keys = malloc(sizeof(int32_t) * GIF_LZW_TABLE_SIZE);
+        if (!gif.bins || !gif.order || !gif.bin_index || !gif.lzw_keys)
+            return 0;
+        gif.lzw_codes = malloc(sizeof(uint16_t) * GIF_LZW_TABLE_SIZE);
+        if (!gif.lzw_codes)
+            return 0;
+        cc_count_allocation();
+    }
+    return reserve_buffer(&gif.indices, &gif.index_capacity, pixel_count);
+}
+
+/** @brief Histogram bin of a premultiplied pixel, composited over black. */
+static unsigned int gif_bin_of(uint32_t pixel)
+{
+    return (((pixel >> 19) & 0x1f) << (2 * GIF_BIN_BITS)) |
+           (((pixel >> 11) & 0x1f) << GIF_BIN_BITS) | ((pixel >> 3) & 0x1f);
+}
+
+/** @brief Sort bins by descending pixel count, ties by bin. */
+static int compare_bins(const void *a, const void *b)
+{
+    const unsigned int bin_a = *(const uint16_t *)a;
+    const unsigned int bin_b = *(const uint16_t *)b;
+    const uint32_t count_a = gif.bins[bin_a * 4];
+    const uint32_t count_b = gif.bins[bin_b * 4];
+    if (count_a != count_b)
+        return count_a > count_b ? -1 : 1;
+    return bin_a < bin_b ? -1 : (bin_a > bin_b);
+}
+
+/** @brief Mean colour of a histogram bin. */
+static void bin_color(unsigned int bin, unsigned char rgb[3])
+{
+    const uint32_t *entry = &gif.bins[bin * 4];
+    for (int c = 0; c < 3; c++)
+        rgb[c] = (unsigned char)((entry[c + 1] + entry[0] / 2) / entry[0]);
+}
+
+/**
+ * @brief Quantize a frame into a palette and per-pixel indices.
+ * @details The 256 most used bins become palette entries with the mean colour
+ * of their pixels, so frames with few colours stay exact. Pixels of other
+ * bins (anti-aliased edges) map to the nearest entry.
+ * @return Number of palette entries
+ */
+static int quantize_gif_frame(const unsigned char *pixels, int width,
+                              int height, int stride,
+                              unsigned char palette[GIF_MAX_COLORS * 3])
+{
+    memset(gif.bins, 0, sizeof(uint32_t) * 4 * GIF_BIN_COUNT);
+    for (int y = 0; y < height; y++)
+    {
+        const uint32_t *row =
+            (const uint32_t *)(const void *)(pixels + (size_t)y * (size_t)stride);
+        for (int x = 0; x < width; x++)
+        {
+            uint32_t *entry = &gif.bins[gif_bin_of(row[x]) * 4];
+            entry[0]++;
+            entry[1] += (row[x] >> 16) & 0xff;
+            entry[2] += (row[x] >> 8) & 0xff;
+            entry[3] += row[x] & 0xff;
+        }
+    }
+
+    int used = 0;
+    for (unsigned int bin = 0; bin < GIF_BIN_COUNT; bin++)
+    {
+        if (gif.bins[bin * 4] != 0)
+            gif.order[used++] = (uint16_t)bin;
+    }
+    if (used > GIF_MAX_COLORS)
+        qsort(gif.order, (size_t)used, sizeof(gif.order[0]), compare_bins);
+
+    const int colors = used < GIF_MAX_COLORS ? used : GIF_MAX_COLORS;
+    for (int i = 0; i < colors; i++)
+    {
+        bin_color(gif.order[i], &palette[i * 3]);
+        gif.bin_index[gif.order[i]] = (unsigned char)i;
+    }
+
+    for (int i = colors; i < used; i++)
+    {
+        unsigned char rgb[3];
+        bin_color(gif.order[i], rgb);
+
+        long best_distance = -1;
+        for (int p = 0; p < colors; p++)
+        {
+            const long dr = (long)rgb[0] - palette[p * 3];
+            const long dg = (long)rgb[1] - palette[p * 3 + 1];
+            const long db = (long)rgb[2] - palette[p * 3 + 2];
+            const long distance = dr * dr + dg * dg + db * db;
+            if (best_distance < 0 || distance < best_distance)
+            {
+                best_distance = distance;
+                gif.bin_index[gif.order[i]] = (unsigned char)p;
+            }
+        }
+    }
+
+    unsigned char *index = gif.indices;
+    for (int y = 0; y < height; y++)
+    {
+        const uint32_t *row =
+            (const uint32_t *)(const void *)(pixels + (size_t)y * (size_t)stride);
+        for (int x = 0; x < width; x++)
+            *index++ = gif.bin_index[gif_bin_of(row[x])];
+    }
+
+    return colors;
+}
+
+/** @brief Flush the pending data sub-block. */
+static int flush_gif_block(png_buffer_t *out)
+{
+    if (gif.block_size == 0)
+        return 1;
+
+    const unsigned char length = (unsigned char)gif.block_size;
+    gif.block_size = 0;
+    return append_bytes(out, &length, 1) &&
+           append_bytes(out, gif.block, length);
+}
+
+/** @brief Write one LZW code, least significant bit first. */
+static int put_gif_code(png_buffer_t *out, unsigned int code, int code_size)
+{
+    gif.bits |= (uint32_t)code << gif.bit_count;
+    gif.bit_count += code_size;
+    while (gif.bit_count >= 8)
+    {
+        gif.block[gif.block_size++] = (unsigned char)gif.bits;
+        gif.bits >>= 8;
+        gif.bit_count -= 8;
+        if (gif.block_size == GIF_BLOCK_SIZE && !flush_gif_block(out))
+            return 0;
+    }
+    return 1;
+}
+
+/** @brief Empty the LZW dictionary. */
+static void reset_lzw_table(void)
+{
+    memset(gif.lzw_keys, 0xff, sizeof(int32_t) * GIF_LZW_TABLE_SIZE);
+}
+
+/** @brief Find the slot of a dictionary key, or the empty slot for it. */
+static size_t find_lzw_slot(int32_t key)
+{
+    size_t slot = ((uint32_t)key * 2654435761u) % GIF_LZW_TABLE_SIZE;
+    while (gif.lzw_keys[slot] != -1 && gif.lzw_keys[slot] != key)
+        slot = (slot + 1) % GIF_LZW_TABLE_SIZE;
+    return slot;
+}
+
+/**
+ * @brief LZW-compress the palette indices of a frame as GIF image data.
+ * @details Codes grow from min_code_size + 1 to 12 bits; a full dictionary
+ * is restarted with a clear code.
+ */
+static int encode_gif_indices(size_t count, int min_code_size,
+                              png_buffer_t *out)
+{
+    const unsigned int clear_code = 1u << min_code_size;
+    const unsigned int end_code = clear_code + 1;
+    unsigned int next_code = clear_code + 2;
+    int code_size = min_code_size + 1;
+
+    const unsigned char min_size_byte = (unsigned char)min_code_size;
+    if (!append_bytes(out, &min_size_byte, 1))
+        return 0;
+
+    gif.block_size = 0;
+    gif.bits = 0;
+    gif.bit_count = 0;
+    reset_lzw_table();
+    if (!put_gif_code(out, clear_code, code_size))
+        return 0;
+
+    unsigned int prefix = gif.indices[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        const int32_t key = (int32_t)((prefix << 8) | gif.indices[i]);
+        const size_t slot = find_lzw_slot(key);
+        if (gif.lzw_keys[slot] == key)
+        {
+            prefix = gif.lzw_codes[slot];
+            continue;
+        }
+
+        if (!put_gif_code(out, prefix, code_size))
+            return 0;
+
+        if (next_code < GIF_LZW_MAX_CODES)
+        {
+            if (next_code == (1u << code_size))
+                code_size++;
+            gif.lzw_keys[slot] = key;
+            gif.lzw_codes[slot] = (uint16_t)next_code++;
+        }
+        else
+        {
+            if (!put_gif_code(out, clear_code, code_size))
+                return 0;
+            reset_lzw_table();
+            next_code = clear_code + 2;
+            code_size = min_code_size + 1;
+        }
+        prefix = gif.indices[i];
+    }
+
+    if (!put_gif_code(out, prefix, code_size))
+        return 0;
+    // The decoder adds one more entry on the final prefix and widens first
+    if (next_code == (1u << code_size) && code_size < 12)
+        code_size++;
+    if (!put_gif_code(out, end_code, code_size))
+        return 0;
+    if (gif.bit_count > 0)
+    {
+        gif.block[gif.block_size++] = (unsigned char)gif.bits;
+        gif.bits = 0;
+        gif.bit_count = 0;
+    }
+
+    static const unsigned char terminator = 0;
+    return flush_gif_block(out) && append_bytes(out, &terminator, 1);
+}
+
+/**
+ * @brief Start an animated GIF that loops forever.
+ */
+int begin_gif_animation(int width, int height, png_buffer_t *out)
+{
+    if (!out || width <= 0 || height <= 0 || width > 0xffff || height > 0xffff)
+        return 0;
+
+    unsigned char header[13 + 19];
+    memcpy(header, "GIF89a", 6);
+    put_u16_le(header + 6, (unsigned int)width);
+    put_u16_le(header + 8, (unsigned int)height);
+    header[10] = 0x70; // No global color table, 8-bit colour resolution
+    header[11] = 0;
+    header[12] = 0;
+
+    /* NETSCAPE2.0 application extension: loop count 0 = forever */
+    unsigned char *loop = header + 13;
+    loop[0] = 0x21;
+    loop[1] = 0xff;
+    loop[2] = 11;
+    memcpy(loop + 3, "NETSCAPE2.0", 11);
+    loop[14] = 3;
+    loop[15] = 1;
+    put_u16_le(loop + 16, 0);
+    loop[18] = 0;
+
+    out->size = 0;
+    return append_bytes(out, header, sizeof(header));
+}
+
+/**
+ * @brief Append one frame with its own color table.
+ */
+int add_gif_frame(cairo_surface_t *surface, unsigned int delay_cs,
+                  png_buffer_t *out)
+{
+    if (!surface || !out || out->size == 0 ||
+        cairo_surface_get_type(surface) != CAIRO_SURFACE_TYPE_IMAGE)
+        return 0;
+
+    const cairo_format_t format = cairo_image_surface_get_format(surface);
+    const unsigned char *pixels = cairo_image_surface_get_data(surface);
+    const int width = cairo_image_surface_get_width(surface);
+    const int height = cairo_image_surface_get_height(surface);
+    const int stride = cairo_image_surface_get_stride(surface);
+    if ((format != CAIRO_FORMAT_ARGB32 && format != CAIRO_FORMAT_RGB24) ||
+        !pixels || width <= 0 || height <= 0 || width > 0xffff ||
+        height > 0xffff)
+        return 0;
+
+    const size_t pixel_count = (size_t)width * (size_t)height;
+    if (!prepare_gif_state(pixel_count))
+    {
+        log_message(LOG_ERROR, "GIF encoder initialization failed");
+        return 0;
+    }
+
+    unsigned char palette[GIF_MAX_COLORS * 3] = {0};
+    const int colors = quantize_gif_frame(pixels, width, height, stride, palette);
+    int table_bits = 1;
+    while ((1 << table_bits) < colors)
+        table_bits++;
+
+    /* Graphic control extension: keep the frame in place, no transparency */
+    unsigned char descriptor[8 + 10];
+    descriptor[0] = 0x21;
+    descriptor[1] = 0xf9;
+    descriptor[2] = 4;
+    descriptor[3] = 0x04;
+    put_u16_le(descriptor + 4, delay_cs > 0xffff ? 0xffff : delay_cs);
+    descriptor[6] = 0;
+    descriptor[7] = 0;
+
+    /* Image descriptor with a local color table */
+    unsigned char *image = descriptor + 8;
+    image[0] = 0x2c;
+    put_u16_le(image + 1, 0);
+    put_u16_le(image + 3, 0);
+    put_u16_le(image + 5, (unsigned int)width);
+    put_u16_le(image + 7, (unsigned int)height);
+    image[9] = (unsigned char)(0x80 | (table_bits - 1));
+
+    const int min_code_size = table_bits < 2 ? 2 : table_bits;
+    return append_bytes(out, descriptor, sizeof(descriptor)) &&
+           append_bytes(out, palette, (size_t)(3 << table_bits)) &&
+           encode_gif_indices(pixel_count, min_code_size, out);
+}
+
+/**
+ * @brief Finish an animated GIF.
+ */
+int finish_gif_animation(png_buffer_t *out)
+{
+    static const unsigned char trailer = 0x3b;
+    return out && out->size > 0 && append_bytes(out, &trailer, 1);
+}
+
+/**
+ * @brief Free encoder state and an output buffer.
+ */
+void cleanup_png_encoder(png_buffer_t *out)
+{
+    if (encoder.initialized)
+        deflateEnd(&encoder.stream);
+    free(encoder.rows);
+    memset(&encoder, 0, sizeof(encoder));
+
+    free(gif.bins);
+    free(gif.order);
+    free(gif.bin_index);
+    free(gif.indices);
+    free(gif.lzw_keys);
+    free(gif.lzw_codes);
+    memset(&gif, 0, sizeof(gif));
+
+    if (out)
+    {
+        free(out->data);
+        out->data = NULL;
+        out->size = 0;
+        out->capacity = 0;
+    }
+}
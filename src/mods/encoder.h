@@ -0,0 +1,86 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief PNG and animated GIF encoder for LCD frames.
+ * @details Encodes cairo image surfaces with a configurable zlib level and a
+ * fixed filter, tuned for small flat-coloured frames. Animations are GIFs
+ * built frame by frame.
+ */
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
+#include <stddef.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+/**
+ * @brief Growable output buffer for encoded PNG or GIF data.
+ * @details Keeps its capacity across frames, so steady-state encoding does not
+ * allocate.
+ */
+typedef struct
+{
+    unsigned char *data;
+    size_t size;
+    size_t capacity;
+} png_buffer_t;
+
+/**
+ * @brief Encode an ARGB32 image surface as PNG.
+ * @details Writes RGB for fully opaque frames and RGBA otherwise. Level 0
+ * stores rows uncompressed, level 1 uses run-length deflate, higher levels the
+ * regular zlib strategy. All rows use the Up filter.
+ * @param surface Flushed ARGB32 image surface
+ * @param compression_level zlib level 0-9
+ * @param out Output buffer, replaced by the encoded PNG
+ * @return 1 on success, 0 on failure
+ */
+int encode_png_frame(cairo_surface_t *surface, int compression_level,
+                     png_buffer_t *out);
+
+/**
+ * @brief Start an endlessly looping animated GIF.
+ * @details Writes the header; add frames with add_gif_frame() and close the
+ * file with finish_gif_animation().
+ * @param width Frame width in pixels
+ * @param height Frame height in pixels
+ * @param out Output buffer, replaced by the GIF header
+ * @return 1 on success, 0 on failure
+ */
+int begin_gif_animation(int width, int height, png_buffer_t *out);
+
+/**
+ * @brief Append an ARGB32 image surface as one GIF frame.
+ * @details Quantizes the frame to at most 256 colours in its own color table;
+ * translucent pixels are composited over black.
+ * @param surface Flushed ARGB32 image surface of the animation's size
+ * @param delay_cs How long the frame is shown, in 1/100 s
+ * @param out Buffer started by begin_gif_animation()
+ * @return 1 on success, 0 on failure
+ */
+int add_gif_frame(cairo_surface_t *surface, unsigned int delay_cs,
+                  png_buffer_t *out);
+
+/**
+ * @brief Write the GIF trailer.
+ * @return 1 on success, 0 on failure
+ */
+int finish_gif_animation(png_buffer_t *out);
+
+/**
+ * @brief Free encoder state and an output buffer.
+ * @param out Output buffer to free (may be NULL)
+ */
+void cleanup_png_encoder(png_buffer_t *out);
+
+#endif // ENCODER_H
@@ -0,0 +1,235 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Per-slot sensor history for sparkline rendering.
+ * @details Rings are written by the render stage only (or the serial render
+ * loop) and cleared while the pipeline is parked, so no locking is needed.
+ */
+
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <string.h>
+#include <time.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../device/config.h"
+#include "../srv/cc_conf.h"
+#include "../srv/cc_sensor.h"
+#include "display.h"
+#include "history.h"
+
+#define SLOT_HISTORY_SLOTS 3
+
+/**
+ * @brief History rings of all displays, allocated with the binary.
+ */
+static struct
+{
+    SlotHistory rings[MAX_LCD_DISPLAYS][SLOT_HISTORY_SLOTS];
+    struct timespec epoch;
+    int has_epoch;
+} history_state;
+
+/**
+ * @brief Seconds since the first recorded sample.
+ * @details Relative times keep float precision in the millisecond range for
+ * months of uptime.
+ */
+static float history_time_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (!history_state.has_epoch)
+    {
+        history_state.epoch = now;
+        history_state.has_epoch = 1;
+    }
+    return (float)((double)(now.tv_sec - history_state.epoch.tv_sec) +
+                   (double)(now.tv_nsec - history_state.epoch.tv_nsec) / 1e9);
+}
+
+/**
+ * @brief Clear a ring and bind it to a slot and window length.
+ */
+static void clear_history(SlotHistory *history, const char *slot, int window)
+{
+    history->sum = 0.0;
+    history->next_seq = 0;
+    history->window = window;
+    history->count = 0;
+    history->min_head = history->min_count = 0;
+    history->max_head = history->max_count = 0;
+    cc_safe_strcpy(history->slot, sizeof(history->slot), slot ? slot : "");
+}
+
+/** @brief Ring position of a sample sequence number. */
+static int seq_position(const SlotHistory *history, uint64_t seq)
+{
+    return (int)(seq % (uint64_t)history->window);
+}
+
+/**
+ * @brief Push a sequence number into a monotonic deque.
+ * @details Drops entries that left the window from the front and entries the
+ * new sample dominates from the back. keep_lower selects the min deque.
+ */
+static void push_extreme(SlotHistory *history, uint64_t *queue, int *head,
+                         int *count, uint64_t seq, float value, int keep_lower)
+{
+    while (*count > 0 && seq - queue[*head] >= (uint64_t)history->window)
+    {
+        *head = (*head + 1) % SLOT_HISTORY_CAPACITY;
+        (*count)--;
+    }
+
+    while (*count > 0)
+    {
+        const int back = (*head + *count - 1) % SLOT_HISTORY_CAPACITY;
+        const float back_value = history->values[seq_position(history, queue[back])];
+        if (keep_lower ? back_value < value : back_value > value)
+            break;
+        (*count)--;
+    }
+
+    queue[(*head + *count) % SLOT_HISTORY_CAPACITY] = seq;
+    (*count)++;
+}
+
+/**
+ * @brief Append a sample, evicting the oldest one when the ring is full.
+ */
+static void push_history(SlotHistory *history, float value, float time)
+{
+    const uint64_t seq = history->next_seq++;
+    const int pos = seq_position(history, seq);
+
+    if (history->count == history->window)
+        history->sum -= history->values[pos];
+    else
+        history->count++;
+
+    history->values[pos] = value;
+    history->times[pos] = time;
+    history->sum += value;
+
+    push_extreme(history, history->min_queue, &history->min_head,
+                 &history->min_count, seq, value, 1);
+    push_extreme(history, history->max_queue, &history->max_head,
+                 &history->max_count, seq, value, 0);
+}
+
+/**
+ * @brief Get the history ring storage of a display.
+ */
+static SlotHistory *display_rings(const struct Config *config)
+{
+    return history_state.rings[get_display_state_index(config)];
+}
+
+void record_slot_history(const struct Config *config,
+                         const monitor_sensor_data_t *data)
+{
+    if (!config || !data || !config->layout_sparkline_enabled)
+        return;
+
+    int window = config->layout_sparkline_samples;
+    if (window < 2)
+        window = 2;
+    if (window > SLOT_HISTORY_CAPACITY)
+        window = SLOT_HISTORY_CAPACITY;
+
+    const char *slots[SLOT_HISTORY_SLOTS] = {
+        config->sensor_slot_1, config->sensor_slot_2, config->sensor_slot_3};
+    SlotHistory *rings = display_rings(config);
+    const float now = history_time_now();
+
+    for (int i = 0; i < SLOT_HISTORY_SLOTS; i++)
+    {
+        SlotHistory *history = &rings[i];
+        if (!slot_is_active(slots[i]))
+        {
+            if (history->count > 0)
+                clear_history(history, NULL, window);
+            continue;
+        }
+
+        if (history->window != window || strcmp(history->slot, slots[i]) != 0)
+            clear_history(history, slots[i], window);
+
+        push_history(history, get_slot_temperature(data, slots[i]), now);
+    }
+}
+
+const SlotHistory *get_slot_history(const struct Config *config,
+                                    const char *slot_value)
+{
+    if (!config || !slot_value || !config->layout_sparkline_enabled)
+        return NULL;
+
+    const SlotHistory *rings = display_rings(config);
+    for (int i = 0; i < SLOT_HISTORY_SLOTS; i++)
+    {
+        if (rings[i].count > 0 && strcmp(rings[i].slot, slot_value) == 0)
+            return &rings[i];
+    }
+    return NULL;
+}
+
+int get_slot_history_sample(const SlotHistory *history, int index,
+                            float *value, float *time)
+{
+    if (!history || index < 0 || index >= history->count)
+        return 0;
+
+    const uint64_t seq = history->next_seq - (uint64_t)history->count +
+                         (uint64_t)index;
+    const int pos = seq_position(history, seq);
+    if (value)
+        *value = history->values[pos];
+    if (time)
+        *time = history->times[pos];
+    return 1;
+}
+
+float get_slot_history_min(const SlotHistory *history)
+{
+    if (!history || history->min_count == 0)
+        return 0.0f;
+    return history->values[seq_position(history,
+                                        history->min_queue[history->min_head])];
+}
+
+float get_slot_history_max(const SlotHistory *history)
+{
+    if (!history || history->max_count == 0)
+        return 0.0f;
+    return history->values[seq_position(history,
+                                        history->max_queue[history->max_head])];
+}
+
+float get_slot_history_avg(const SlotHistory *history)
+{
+    if (!history || history->count == 0)
+        return 0.0f;
+    return (float)(history->sum / history->count);
+}
+
+void reset_slot_history(void)
+{
+    for (int d = 0; d < MAX_LCD_DISPLAYS; d++)
+    {
+        for (int i = 0; i < SLOT_HISTORY_SLOTS; i++)
+            clear_history(&history_state.rings[d][i], NULL, 0);
+    }
+}
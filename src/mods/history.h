@@ -0,0 +1,95 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Per-slot sensor history for sparkline rendering.
+ * @details Fixed-size ring buffers, one per display and sensor slot, stored
+ * statically so recording a sample never allocates. Window min, max and
+ * average are maintained incrementally on every sample.
+ */
+
+#ifndef HISTORY_H
+#define HISTORY_H
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <stdint.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../device/config.h"
+#include "../srv/cc_sensor.h"
+
+// Ring capacity per slot; layout.sparkline_samples is clamped to this
+#define SLOT_HISTORY_CAPACITY 240
+
+/**
+ * @brief Sample ring of one sensor slot.
+ * @details Values and timestamps are kept as separate arrays so drawing walks
+ * contiguous floats. The min/max deques hold sample sequence numbers in
+ * monotonic value order (sliding window extremes in amortized O(1)).
+ */
+typedef struct
+{
+    float values[SLOT_HISTORY_CAPACITY];
+    float times[SLOT_HISTORY_CAPACITY]; // Seconds since the history epoch
+    uint64_t min_queue[SLOT_HISTORY_CAPACITY];
+    uint64_t max_queue[SLOT_HISTORY_CAPACITY];
+    char slot[CONFIG_MAX_SENSOR_SLOT_LEN]; // Slot value the samples belong to
+    double sum;
+    uint64_t next_seq; // Sequence number of the next sample
+    int window;        // Ring length in use (1..SLOT_HISTORY_CAPACITY)
+    int count;         // Samples held (0..window)
+    int min_head, min_count;
+    int max_head, max_count;
+} SlotHistory;
+
+/**
+ * @brief Record the current values of all active slots of a display.
+ * @details Does nothing unless layout.sparkline is enabled. A ring is cleared
+ * when its slot assignment or window length changes.
+ * @param config Display configuration (slots, sparkline settings)
+ * @param data Sensor data of the current tick
+ */
+void record_slot_history(const struct Config *config,
+                         const monitor_sensor_data_t *data);
+
+/**
+ * @brief Get the history ring of a sensor slot.
+ * @param config Display configuration
+ * @param slot_value Slot configuration value
+ * @return Ring with at least one sample, or NULL
+ */
+const SlotHistory *get_slot_history(const struct Config *config,
+                                    const char *slot_value);
+
+/**
+ * @brief Get a sample by age.
+ * @param history History ring
+ * @param index 0 for the oldest sample, count-1 for the newest
+ * @param value Output sample value
+ * @param time Output sample time in seconds since the history epoch
+ * @return 1 on success, 0 if index is out of range
+ */
+int get_slot_history_sample(const SlotHistory *history, int index,
+                            float *value, float *time);
+
+/** @brief Smallest value in the window (0 when empty). */
+float get_slot_history_min(const SlotHistory *history);
+
+/** @brief Largest value in the window (0 when empty). */
+float get_slot_history_max(const SlotHistory *history);
+
+/** @brief Average value of the window (0 when empty). */
+float get_slot_history_avg(const SlotHistory *history);
+
+/** @brief Clear the history of all displays (config reload). */
+void reset_slot_history(void);
+
+#endif // HISTORY_H
@@ -0,0 +1,249 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Cached font faces and memoised text metrics.
+ * @details Used by the render stage only (or the serial render loop) and
+ * reset while the pipeline is parked, so no locking is needed. The caches are
+ * direct-mapped: a colliding entry simply replaces the old one.
+ */
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
+#include <stdint.h>
+#include <string.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Include project headers
+#include "../device/config.h"
+#include "../srv/cc_conf.h"
+#include "text.h"
+
+// Distinct font names cached at once (one per display is typical)
+#define TEXT_FACE_CACHE_SIZE (2 * MAX_LCD_DISPLAYS)
+
+// Memoised strings: values, units and labels at the sizes tried by fitting
+#define TEXT_EXTENTS_CACHE_SIZE 512
+#define TEXT_EXTENTS_MAX_LEN 48
+#define FONT_EXTENTS_CACHE_SIZE 128
+
+/** @brief A resolved font face. */
+typedef struct
+{
+    char name[CONFIG_MAX_FONT_NAME_LEN];
+    text_weight_t weight;
+    cairo_font_face_t *face;
+} CachedFace;
+
+/** @brief Memoised text extents of one string at one face and size. */
+typedef struct
+{
+    const cairo_font_face_t *face;
+    double size;
+    char text[TEXT_EXTENTS_MAX_LEN];
+    cairo_text_extents_t ext;
+} CachedTextExtents;
+
+/** @brief Memoised font extents of one face and size. */
+typedef struct
+{
+    const cairo_font_face_t *face;
+    double size;
+    cairo_font_extents_t ext;
+} CachedFontExtents;
+
+static struct
+{
+    CachedFace faces[TEXT_FACE_CACHE_SIZE];
+    int face_count;
+    CachedTextExtents text[TEXT_EXTENTS_CACHE_SIZE];
+    CachedFontExtents fonts[FONT_EXTENTS_CACHE_SIZE];
+} text_cache;
+
+static unsigned long text_cache_generation = 1;
+
+/** @brief FNV-1a over a memory block. */
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+const cairo_font_face_t *get_text_font(cairo_t *cr)
+{
+    if (!cr)
+        return NULL;
+
+    const cairo_font_face_t *face = cairo_get_font_face(cr);
+    for (int i = 0; i < text_cache.face_count; i++)
+    {
+        if (text_cache.faces[i].face == face)
+            return face;
+    }
+    return NULL;
+}
+
+unsigned long get_text_cache_generation(void)
+{
+    return text_cache_generation;
+}
+
+/**
+ * @brief Current font face and size of a context.
+ * @details The renderers never rotate or skew text, so the matrix diagonal
+ * is the font size.
+ */
+static const cairo_font_face_t *current_font(cairo_t *cr, double *size)
+{
+    cairo_matrix_t matrix;
+    cairo_get_font_matrix(cr, &matrix);
+    *size = matrix.yy;
+    return get_text_font(cr);
+}
+
+/**
+ * @brief Get the cached face of a font name and weight, creating it once.
+ */
+static cairo_font_face_t *get_font_face(const char *name, text_weight_t weight)
+{
+    for (int i = 0; i < text_cache.face_count; i++)
+    {
+        const CachedFace *cached = &text_cache.faces[i];
+        if (cached->weight == weight && strcmp(cached->name, name) == 0)
+            return cached->face;
+    }
+
+    cairo_font_face_t *face = cairo_toy_font_face_create(
+        name, CAIRO_FONT_SLANT_NORMAL,
+        weight == TEXT_WEIGHT_BOLD ? CAIRO_FONT_WEIGHT_BOLD
+                                   : CAIRO_FONT_WEIGHT_NORMAL);
+    if (cairo_font_face_status(face) != CAIRO_STATUS_SUCCESS)
+    {
+        cairo_font_face_destroy(face);
+        return NULL;
+    }
+
+    // Table full: start over, metrics are keyed by face pointers
+    if (text_cache.face_count == TEXT_FACE_CACHE_SIZE)
+        reset_text_cache();
+
+    CachedFace *cached = &text_cache.faces[text_cache.face_count++];
+    cc_safe_strcpy(cached->name, sizeof(cached->name), name);
+    cached->weight = weight;
+    cached->face = face;
+    return face;
+}
+
+void select_text_font(cairo_t *cr, const struct Config *config,
+                      text_weight_t weight)
+{
+    if (!cr || !config)
+        return;
+
+    cairo_font_face_t *face = get_font_face(config->font_face, weight);
+    if (face)
+        cairo_set_font_face(cr, face);
+    else
+        cairo_select_font_face(cr, config->font_face, CAIRO_FONT_SLANT_NORMAL,
+                               weight == TEXT_WEIGHT_BOLD
+                                   ? CAIRO_FONT_WEIGHT_BOLD
+                                   : CAIRO_FONT_WEIGHT_NORMAL);
+}
+
+void measure_text(cairo_t *cr, const char *text, cairo_text_extents_t *ext)
+{
+    if (!cr || !text || !ext)
+        return;
+
+    const size_t length = strlen(text);
+    if (length >= TEXT_EXTENTS_MAX_LEN)
+    {
+        cairo_text_extents(cr, text, ext);
+        return;
+    }
+
+    double size = 0.0;
+    const cairo_font_face_t *face = current_font(cr, &size);
+    if (!face)
+    {
+        cairo_text_extents(cr, text, ext);
+        return;
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hash_bytes(hash, &face, sizeof(face));
+    hash = hash_bytes(hash, &size, sizeof(size));
+    hash = hash_bytes(hash, text, length);
+    CachedTextExtents *entry = &text_cache.text[hash % TEXT_EXTENTS_CACHE_SIZE];
+
+    if (entry->face != face || entry->size != size ||
+        strcmp(entry->text, text) != 0)
+    {
+        cairo_text_extents(cr, text, &entry->ext);
+        if (cairo_status(cr) != CAIRO_STATUS_SUCCESS)
+        {
+            entry->face = NULL;
+            *ext = entry->ext;
+            return;
+        }
+        entry->face = face;
+        entry->size = size;
+        memcpy(entry->text, text, length + 1);
+    }
+
+    *ext = entry->ext;
+}
+
+void measure_font(cairo_t *cr, cairo_font_extents_t *ext)
+{
+    if (!cr || !ext)
+        return;
+
+    double size = 0.0;
+    const cairo_font_face_t *face = current_font(cr, &size);
+    if (!face)
+    {
+        cairo_font_extents(cr, ext);
+        return;
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hash_bytes(hash, &face, sizeof(face));
+    hash = hash_bytes(hash, &size, sizeof(size));
+    CachedFontExtents *entry = &text_cache.fonts[hash % FONT_EXTENTS_CACHE_SIZE];
+
+    if (entry->face != face || entry->size != size)
+    {
+        cairo_font_extents(cr, &entry->ext);
+        if (cairo_status(cr) != CAIRO_STATUS_SUCCESS)
+        {
+            entry->face = NULL;
+            *ext = entry->ext;
+            return;
+        }
+        entry->face = face;
+        entry->size = size;
+    }
+
+    *ext = entry->ext;
+}
+
+void reset_text_cache(void)
+{
+    for (int i = 0; i < text_cache.face_count; i++)
+        cairo_font_face_destroy(text_cache.faces[i].face);
+    memset(&text_cache, 0, sizeof(text_cache));
+    text_cache_generation++;
+}
@@ -0,0 +1,71 @@
+/**
+ * @author damachine (damachin3 at proton dot me)
+ * @Maintainer: damachine (damachin3 at proton dot me)
+ * @website https://github.com/damachine/coolerdash
+ * @copyright (c) 2025 damachine
+ * @license MIT
+ *    This software is provided "as is", without warranty of any kind...
+ */
+
+/**
+ * @brief Cached font faces and memoised text metrics.
+ * @details The configured font is resolved through fontconfig once per face
+ * name and weight and then reused by every frame. Text and font extents are
+ * memoised per face, size and string, so fitting loops over the small set of
+ * rendered strings (digits, units, labels) stop re-measuring.
+ */
+
+#ifndef TEXT_H
+#define TEXT_H
+
+// Include necessary headers
+// cppcheck-suppress-begin missingIncludeSystem
+#include <cairo/cairo.h>
+// cppcheck-suppress-end missingIncludeSystem
+
+// Forward declarations
+struct Config;
+
+/** @brief Font weights used by the renderers. */
+typedef enum
+{
+    TEXT_WEIGHT_NORMAL,
+    TEXT_WEIGHT_BOLD,
+    TEXT_WEIGHT_COUNT
+} text_weight_t;
+
+/**
+ * @brief Select the configured font face on a context.
+ * @details Replaces cairo_select_font_face(); the face is created on first
+ * use and kept until reset_text_cache().
+ * @param cr Cairo context
+ * @param config Configuration with font_face
+ * @param weight Normal or bold
+ */
+void select_text_font(cairo_t *cr, const struct Config *config,
+                      text_weight_t weight);
+
+/**
+ * @brief Text extents of a string at the context's current font and size.
+ * @details Memoised; strings longer than the cache key are measured directly.
+ */
+void measure_text(cairo_t *cr, const char *text, cairo_text_extents_t *ext);
+
+/** @brief Font extents at the context's current font and size (memoised). */
+void measure_font(cairo_t *cr, cairo_font_extents_t *ext);
+
+/**
+ * @brief Get the context's font face if it is owned by the text cache.
+ * @details Cached faces are valid keys for memoised layouts together with
+ * get_text_cache_generation(); other faces may be freed and their address
+ * reused, so NULL means "do not memoise".
+ */
+const cairo_font_face_t *get_text_font(cairo_t *cr);
+
+/** @brief Counter bumped whenever cached faces are released. */
+unsigned long get_text_cache_generation(void);
+
+/** @brief Drop cached faces and metrics (config reload, font change). */
+void reset_text_cache(void);
+
+#endif // TEXT_H
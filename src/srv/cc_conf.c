@@ -19,9 +19,11 @@
 #include <ctype.h>
 #include <curl/curl.h>
 #include <jansson.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 // cppcheck-suppress-end missingIncludeSystem
 
 // Include project headers
@@ -50,60 +52,199 @@ int cc_safe_strcpy(char *restrict dest, size_t dest_size,
     return 0;
 }
 
-/** @brief Device UID/name/dimensions cache (populated once at startup). */
-static struct
+/** @brief One LCD candidate found in /devices. */
+typedef struct
 {
-    int initialized;
     char device_uid[128];
     char device_name[CC_NAME_SIZE];
+    char device_type[16];
     int screen_width;
     int screen_height;
     int is_circular;
-} device_cache = {0};
+    int score;
+} lcd_device_t;
 
-/** @brief Name/type cache for all devices (populated from /devices). */
+/**
+ * @brief LCD candidate cache (populated once at startup).
+ * @details Candidates are sorted by detection score, best first. Each display
+ * config selects its device from this list, so /devices is fetched once for
+ * all LCDs. Only init_device_cache() fills it, at startup or on a reload with
+ * the pipeline parked; the running stages only read it.
+ */
 static struct
+{
+    int initialized;
+    int count;
+    lcd_device_t devices[MAX_LCD_CANDIDATES];
+} device_cache = {0};
+
+/** @brief Name and type of one device (populated from /devices). */
+typedef struct
 {
     char uid[128];
     char name[CC_NAME_SIZE];
     char type[16];
-} device_name_cache[MAX_DEVICE_NAME_CACHE];
-static int device_name_cache_count = 0;
+} device_name_entry_t;
+
+/**
+ * @brief Name/type cache for all devices, keyed by UID.
+ * @details Open addressing with linear probing; at most MAX_DEVICE_NAME_CACHE
+ * devices are stored, so the table stays at most half full and a probe ends
+ * on the first empty slot. Filled by init_device_cache() from the main thread
+ * (at startup, or on a reload with the pipeline parked) and refreshed from
+ * the fetch stage only while the pipeline runs, so it needs no lock.
+ */
+static struct
+{
+    device_name_entry_t entries[DEVICE_NAME_TABLE_SIZE];
+    int count;
+    double last_refresh;
+    double refresh_interval;
+} device_names = {0};
+
+/**
+ * @brief Interned devices of the sensor table.
+ * @details records is append-only; slots maps a UID hash (linear probing,
+ * like device_names) to 1 + the index of the UID's current record. Written
+ * by the fetch stage only; the render stage reads records through sensor
+ * entries published under the pipeline lock.
+ */
+static struct
+{
+    sensor_device_t records[MAX_SENSOR_DEVICE_RECORDS];
+    int record_count;
+    short slots[SENSOR_DEVICE_TABLE_SIZE];
+    int id_count;
+} sensor_devices = {0};
 
 /** @brief Reset device cache for SIGHUP config reload. */
 void reset_device_cache(void)
 {
     memset(&device_cache, 0, sizeof(device_cache));
-    memset(device_name_cache, 0, sizeof(device_name_cache));
-    device_name_cache_count = 0;
+    memset(&device_names, 0, sizeof(device_names));
+    memset(&sensor_devices, 0, sizeof(sensor_devices));
+}
+
+/** @brief Seconds on the monotonic clock. */
+static double monotonic_seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/** @brief FNV-1a hash of a device UID. */
+static uint32_t hash_device_uid(const char *device_uid)
+{
+    uint32_t hash = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)device_uid; *c; c++)
+    {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Find the entry of a UID, or the empty slot it would be stored in.
+ */
+static device_name_entry_t *find_device_entry(const char *device_uid)
+{
+    size_t index = hash_device_uid(device_uid) % DEVICE_NAME_TABLE_SIZE;
+    for (int probe = 0; probe < DEVICE_NAME_TABLE_SIZE; probe++)
+    {
+        device_name_entry_t *entry = &device_names.entries[index];
+        if (entry->uid[0] == '\0' || strcmp(entry->uid, device_uid) == 0)
+            return entry;
+        index = (index + 1) % DEVICE_NAME_TABLE_SIZE;
+    }
+    return NULL;
 }
 
 /** @brief Look up device display name by UID. */
 const char *get_device_name_by_uid(const char *device_uid)
 {
-    if (!device_uid)
+    if (!device_uid || device_uid[0] == '\0')
         return "";
-    for (int i = 0; i < device_name_cache_count; i++)
-    {
-        if (strcmp(device_name_cache[i].uid, device_uid) == 0)
-            return device_name_cache[i].name;
-    }
-    return "";
+    const device_name_entry_t *entry = find_device_entry(device_uid);
+    return (entry && entry->uid[0] != '\0') ? entry->name : "";
 }
 
 /** @brief Look up device type string by UID. */
 const char *get_device_type_by_uid(const char *device_uid)
 {
-    if (!device_uid)
+    if (!device_uid || device_uid[0] == '\0')
         return NULL;
-    for (int i = 0; i < device_name_cache_count; i++)
+    const device_name_entry_t *entry = find_device_entry(device_uid);
+    return (entry && entry->uid[0] != '\0') ? entry->type : NULL;
+}
+
+/** @brief Returns 1 if a UID is in the device name cache. */
+int is_device_uid_cached(const char *device_uid)
+{
+    if (!device_uid || device_uid[0] == '\0')
+        return 0;
+    const device_name_entry_t *entry = find_device_entry(device_uid);
+    return entry && entry->uid[0] != '\0';
+}
+
+/**
+ * @brief Find the slot holding a UID's current record, or the empty slot it
+ * would be stored in.
+ */
+static short *find_sensor_device_slot(const char *device_uid)
+{
+    size_t index = hash_device_uid(device_uid) % SENSOR_DEVICE_TABLE_SIZE;
+    for (int probe = 0; probe < SENSOR_DEVICE_TABLE_SIZE; probe++)
     {
-        if (strcmp(device_name_cache[i].uid, device_uid) == 0)
-            return device_name_cache[i].type;
+        short *slot = &sensor_devices.slots[index];
+        if (*slot == 0 ||
+            strcmp(sensor_devices.records[*slot - 1].uid, device_uid) == 0)
+            return slot;
+        index = (index + 1) % SENSOR_DEVICE_TABLE_SIZE;
     }
     return NULL;
 }
 
+/** @brief Intern a device; a changed name or type gets a fresh record. */
+const sensor_device_t *intern_sensor_device(const char *device_uid,
+                                            const char *device_type)
+{
+    if (!device_uid || device_uid[0] == '\0' ||
+        strlen(device_uid) >= SENSOR_DEVICE_UID_LEN)
+        return NULL;
+    if (!device_type)
+        device_type = "";
+
+    short *slot = find_sensor_device_slot(device_uid);
+    if (!slot)
+        return NULL;
+
+    const char *name = get_device_name_by_uid(device_uid);
+    const sensor_device_t *current =
+        *slot ? &sensor_devices.records[*slot - 1] : NULL;
+    if (current && strcmp(current->name, name) == 0 &&
+        strcmp(current->type, device_type) == 0)
+        return current;
+
+    if (!current && sensor_devices.id_count >= MAX_SENSOR_DEVICES)
+        return NULL;
+    if (sensor_devices.record_count >= MAX_SENSOR_DEVICE_RECORDS)
+    {
+        // Out of records: keep the stale name rather than lose the sensors
+        return current;
+    }
+
+    sensor_device_t *record =
+        &sensor_devices.records[sensor_devices.record_count];
+    record->id = current ? current->id : sensor_devices.id_count++;
+    cc_safe_strcpy(record->uid, sizeof(record->uid), device_uid);
+    cc_safe_strcpy(record->name, sizeof(record->name), name);
+    cc_safe_strcpy(record->type, sizeof(record->type), device_type);
+    *slot = (short)(++sensor_devices.record_count);
+    return record;
+}
+
 /** @brief Extract device type from JSON ("type" or fallback "d_type"). */
 const char *extract_device_type_from_json(const json_t *dev)
 {
@@ -246,41 +387,6 @@ static void extract_lcd_dimensions(const json_t *dev, int *width, int *height)
     }
 }
 
-/**
- * @brief Initialize cached LCD output parameters to default values.
- */
-static void initialize_cached_lcd_output_params(
-    char *lcd_uid, size_t uid_size, int *found_lcd_device, int *screen_width,
-    int *screen_height, char *device_name, size_t name_size)
-{
-    if (lcd_uid && uid_size > 0)
-        lcd_uid[0] = '\0';
-    if (found_lcd_device)
-        *found_lcd_device = 0;
-    if (screen_width)
-        *screen_width = 0;
-    if (screen_height)
-        *screen_height = 0;
-    if (device_name && name_size > 0)
-        device_name[0] = '\0';
-}
-
-/**
- * @brief Extract all information from a CoolerControl LCD device.
- */
-static void extract_lcd_device_info(const json_t *dev, char *lcd_uid,
-                                    size_t uid_size, int *found_lcd_device,
-                                    int *screen_width, int *screen_height,
-                                    char *device_name, size_t name_size)
-{
-    if (found_lcd_device)
-        *found_lcd_device = 1;
-
-    extract_device_uid(dev, lcd_uid, uid_size);
-    extract_device_name(dev, device_name, name_size);
-    extract_lcd_dimensions(dev, screen_width, screen_height);
-}
-
 /**
  * @brief Check if a CoolerControl device has an LCD display.
  * @details Verifies that a supported channel exposes lcd_info with valid
@@ -489,17 +595,45 @@ static int score_lcd_candidate(const Config *config, const char *device_uid,
 }
 
 /**
- * @brief Search for the best CoolerControl LCD device candidate.
+ * @brief Insert an LCD candidate into the cache, keeping it sorted by score.
+ */
+static void add_lcd_candidate(const json_t *dev, const char *type_str,
+                              int score)
+{
+    int pos = device_cache.count;
+    while (pos > 0 && device_cache.devices[pos - 1].score < score)
+        pos--;
+
+    if (pos >= MAX_LCD_CANDIDATES)
+        return;
+
+    const int last = (device_cache.count < MAX_LCD_CANDIDATES)
+                         ? device_cache.count
+                         : MAX_LCD_CANDIDATES - 1;
+    memmove(&device_cache.devices[pos + 1], &device_cache.devices[pos],
+            (size_t)(last - pos) * sizeof(device_cache.devices[0]));
+    if (device_cache.count < MAX_LCD_CANDIDATES)
+        device_cache.count++;
+
+    lcd_device_t *lcd = &device_cache.devices[pos];
+    memset(lcd, 0, sizeof(*lcd));
+    extract_device_uid(dev, lcd->device_uid, sizeof(lcd->device_uid));
+    extract_device_name(dev, lcd->device_name, sizeof(lcd->device_name));
+    extract_lcd_dimensions(dev, &lcd->screen_width, &lcd->screen_height);
+    if (type_str)
+        cc_safe_strcpy(lcd->device_type, sizeof(lcd->device_type), type_str);
+    lcd->is_circular = is_circular_display_device(
+        lcd->device_name, lcd->screen_width, lcd->screen_height);
+    lcd->score = score;
+}
+
+/**
+ * @brief Collect all CoolerControl LCD device candidates.
  * @details Uses UID, LCD metadata, and configurable allow/block heuristics.
  */
-static int search_lcd_device(const Config *config, const json_t *devices, char *lcd_uid,
-                             size_t uid_size, int *found_lcd_device,
-                             int *screen_width, int *screen_height,
-                             char *device_name, size_t name_size)
+static int search_lcd_devices(const Config *config, const json_t *devices)
 {
-    const json_t *best_dev = NULL;
-    int best_score = -1001;
-    int candidate_count = 0;
+    device_cache.count = 0;
 
     const size_t device_count = json_array_size(devices);
     for (size_t i = 0; i < device_count; i++)
@@ -547,12 +681,7 @@ static int search_lcd_device(const Config *config, const json_t *devices, char *
             continue;
         }
 
-        candidate_count++;
-        if (score > best_score)
-        {
-            best_score = score;
-            best_dev = dev;
-        }
+        add_lcd_candidate(dev, type_str, score);
 
         log_message(LOG_INFO,
                     "LCD candidate score=%d: %s [%s] (%dx%d, uid=%s)", score,
@@ -561,183 +690,181 @@ static int search_lcd_device(const Config *config, const json_t *devices, char *
                     uid_value[0] != '\0' ? uid_value : "n/a");
     }
 
-    if (best_dev)
-    {
-        extract_lcd_device_info(best_dev, lcd_uid, uid_size, found_lcd_device,
-                                screen_width, screen_height, device_name,
-                                name_size);
-        return 1;
-    }
-
-    if (candidate_count == 0)
+    if (device_cache.count == 0)
     {
         log_message(LOG_WARNING,
                     "No suitable LCD device candidates found after filtering");
+        return 0;
     }
 
-    return 0;
+    return 1;
 }
 
 /**
- * @brief Parse devices JSON and extract LCD UID, display info and device name.
+ * @brief Configure CURL options for device cache request.
  */
-static int parse_lcd_device_data(const Config *config, const char *json,
-                                 char *lcd_uid, size_t uid_size,
-                                 int *found_lcd_device, int *screen_width,
-                                 int *screen_height, char *device_name,
-                                 size_t name_size)
+static void configure_device_cache_curl(CURL *curl, http_response *chunk)
 {
-    if (!json)
-        return 0;
+    curl_easy_setopt(curl, CURLOPT_URL, get_session_url(CC_ENDPOINT_DEVICES));
+    curl_easy_setopt(
+        curl, CURLOPT_WRITEFUNCTION,
+        (size_t (*)(const void *, size_t, size_t, void *))write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, chunk);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER,
+                     get_session_headers(CC_HEADERS_DEFAULT));
+}
 
-    initialize_cached_lcd_output_params(lcd_uid, uid_size, found_lcd_device,
-                                        screen_width, screen_height,
-                                        device_name, name_size);
+/**
+ * @brief Add or update one device of the /devices array in the name cache.
+ * @return 1 if the device was new, 0 otherwise
+ */
+static int store_device_name(const json_t *dev)
+{
+    const json_t *uid_val = json_object_get(dev, "uid");
+    if (!uid_val || !json_is_string(uid_val) ||
+        json_string_value(uid_val)[0] == '\0')
+        return 0;
 
-    json_error_t error;
-    json_t *root = json_loads(json, 0, &error);
-    if (!root)
-    {
-        log_message(LOG_ERROR, "JSON parse error: %s", error.text);
+    const char *uid = json_string_value(uid_val);
+    device_name_entry_t *entry = find_device_entry(uid);
+    if (!entry)
         return 0;
-    }
 
-    const json_t *devices = json_object_get(root, "devices");
-    if (!devices || !json_is_array(devices))
+    const int is_new = (entry->uid[0] == '\0');
+    if (is_new)
     {
-        json_decref(root);
-        return 0;
+        if (device_names.count >= MAX_DEVICE_NAME_CACHE)
+            return 0;
+        cc_safe_strcpy(entry->uid, sizeof(entry->uid), uid);
+        device_names.count++;
     }
 
-    int result = search_lcd_device(config, devices, lcd_uid, uid_size,
-                                   found_lcd_device, screen_width,
-                                   screen_height, device_name, name_size);
-    json_decref(root);
-    return result;
+    const json_t *name_val = json_object_get(dev, "name");
+    const char *type_str = extract_device_type_from_json(dev);
+    cc_safe_strcpy(entry->name, sizeof(entry->name),
+                   (name_val && json_is_string(name_val))
+                       ? json_string_value(name_val)
+                       : "");
+    cc_safe_strcpy(entry->type, sizeof(entry->type), type_str ? type_str : "");
+    return is_new;
 }
 
 /**
- * @brief Configure CURL options for device cache request.
+ * @brief Merge the parsed JSON devices array into the name cache.
+ * @details Caches UID, name, and type for all devices (not just Liquidctl).
+ * Known devices are updated in place, so a refresh never drops names.
+ * @return Number of devices added
  */
-static void configure_device_cache_curl(CURL *curl, const Config *config,
-                                        const char *url,
-                                        http_response *chunk,
-                                        struct curl_slist **headers)
+static int populate_device_name_cache(const json_t *devices)
 {
-    (void)config;
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(
-        curl, CURLOPT_WRITEFUNCTION,
-        (size_t (*)(const void *, size_t, size_t, void *))write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, chunk);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 2L);
-
-    *headers = curl_slist_append(NULL, "accept: application/json");
-
-    const char *bearer = get_session_access_token();
-    if (bearer && bearer[0] != '\0')
-        *headers = curl_slist_append(*headers, bearer);
+    int added = 0;
+    const size_t count = json_array_size(devices);
+    for (size_t i = 0; i < count; i++)
+    {
+        const json_t *dev = json_array_get(devices, i);
+        if (dev)
+            added += store_device_name(dev);
+    }
 
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, *headers);
+    device_names.last_refresh = monotonic_seconds();
+    log_message(LOG_INFO, "Device name cache: %d devices cached (%d new)",
+                device_names.count, added);
+    return added;
 }
 
 /**
- * @brief Populate device name cache from parsed JSON devices array.
- * @details Caches UID, name, and type for all devices (not just Liquidctl).
+ * @brief Parse a /devices document.
+ * @return Root JSON object with a "devices" array, or NULL
  */
-static void populate_device_name_cache(const char *json_data)
+static json_t *parse_devices_document(const char *json, size_t json_size)
 {
-    if (!json_data)
-        return;
+    if (!json || json_size == 0)
+        return NULL;
 
     json_error_t error;
-    json_t *root = json_loads(json_data, 0, &error);
+    json_t *root = json_loadb(json, json_size, 0, &error);
     if (!root)
-        return;
+    {
+        log_message(LOG_ERROR, "JSON parse error: %s", error.text);
+        return NULL;
+    }
 
     const json_t *devices = json_object_get(root, "devices");
     if (!devices || !json_is_array(devices))
     {
         json_decref(root);
-        return;
+        return NULL;
     }
+    return root;
+}
 
-    device_name_cache_count = 0;
-    const size_t count = json_array_size(devices);
-    for (size_t i = 0; i < count && device_name_cache_count < MAX_DEVICE_NAME_CACHE; i++)
-    {
-        const json_t *dev = json_array_get(devices, i);
-        if (!dev)
-            continue;
-
-        const json_t *uid_val = json_object_get(dev, "uid");
-        const json_t *name_val = json_object_get(dev, "name");
-        const char *type_str = extract_device_type_from_json(dev);
-
-        if (!uid_val || !json_is_string(uid_val))
-            continue;
+/**
+ * @brief Fetch and parse GET /devices on a pooled handle.
+ * @return Root JSON object (caller frees with json_decref), or NULL
+ */
+static json_t *fetch_devices_document(void)
+{
+    if (get_session_url(CC_ENDPOINT_DEVICES)[0] == '\0')
+        return NULL;
 
-        int idx = device_name_cache_count;
-        cc_safe_strcpy(device_name_cache[idx].uid,
-                       sizeof(device_name_cache[idx].uid),
-                       json_string_value(uid_val));
+    // Joins the shared pool: the connection stays open for sensors and uploads
+    CURL *curl = cc_create_easy_handle();
+    if (!curl)
+        return NULL;
 
-        if (name_val && json_is_string(name_val))
-            cc_safe_strcpy(device_name_cache[idx].name,
-                           sizeof(device_name_cache[idx].name),
-                           json_string_value(name_val));
-        else
-            device_name_cache[idx].name[0] = '\0';
+    http_response chunk = {0};
+    chunk.data = malloc(4096);
+    if (!chunk.data)
+    {
+        cc_release_easy_handle(curl);
+        return NULL;
+    }
+    chunk.size = 0;
+    chunk.capacity = 4096;
 
-        if (type_str)
-            cc_safe_strcpy(device_name_cache[idx].type,
-                           sizeof(device_name_cache[idx].type),
-                           type_str);
-        else
-            device_name_cache[idx].type[0] = '\0';
+    configure_device_cache_curl(curl, &chunk);
 
-        device_name_cache_count++;
+    json_t *root = NULL;
+    const CURLcode res = cc_perform_transfer(curl, 2000L);
+    cc_record_transfer(curl);
+    if (res == CURLE_OK)
+    {
+        root = parse_devices_document(chunk.data, chunk.size);
     }
 
-    log_message(LOG_INFO, "Device name cache: %d devices cached",
-                device_name_cache_count);
-    json_decref(root);
+    free(chunk.data);
+    cc_release_easy_handle(curl);
+
+    return root;
 }
 
 /**
- * @brief Process device cache API response and populate cache.
+ * @brief Populate the device caches from a parsed /devices document.
+ * @details The document is parsed once and feeds both the device name cache
+ * and the LCD candidate search.
  */
 static int process_device_cache_response(const Config *config,
-                                         const http_response *chunk)
+                                         const json_t *root)
 {
+    const json_t *devices = json_object_get(root, "devices");
+
     /* Populate device name cache for ALL devices (used by sensor system) */
-    populate_device_name_cache(chunk->data);
-
-    int found_lcd_device = 0;
-    int result = parse_lcd_device_data(
-        config, chunk->data, device_cache.device_uid,
-        sizeof(device_cache.device_uid),
-        &found_lcd_device, &device_cache.screen_width,
-        &device_cache.screen_height, device_cache.device_name,
-        sizeof(device_cache.device_name));
-
-    if (result && found_lcd_device)
-    {
-        device_cache.initialized = 1;
-        device_cache.is_circular = is_circular_display_device(
-            device_cache.device_name, device_cache.screen_width,
-            device_cache.screen_height);
-
-        const char *shape_mode = device_cache.is_circular
-                                     ? "scaled (circular)"
-                                     : "unscaled (rectangular)";
+    populate_device_name_cache(devices);
+
+    if (!search_lcd_devices(config, devices))
+        return 0;
+
+    device_cache.initialized = 1;
+    for (int i = 0; i < device_cache.count; i++)
+    {
+        const lcd_device_t *lcd = &device_cache.devices[i];
+        const char *shape_mode = lcd->is_circular ? "scaled (circular)"
+                                                  : "unscaled (rectangular)";
         log_message(LOG_STATUS, "Device cache initialized: %s (%dx%d pixel, %s)",
-                    device_cache.device_name, device_cache.screen_width,
-                    device_cache.screen_height, shape_mode);
-        return 1;
+                    lcd->device_name, lcd->screen_width, lcd->screen_height,
+                    shape_mode);
     }
-
-    return 0;
+    return 1;
 }
 
 /**
@@ -751,42 +878,144 @@ static int initialize_device_cache(const Config *config)
     if (!config)
         return 0;
 
-    CURL *curl = curl_easy_init();
-    if (!curl)
+    json_t *root = fetch_devices_document();
+    if (!root)
         return 0;
 
-    char url[512];
-    int ret = snprintf(url, sizeof(url), "%s/devices", config->daemon_address);
-    if (ret >= (int)sizeof(url) || ret < 0)
-    {
-        curl_easy_cleanup(curl);
+    const int success = process_device_cache_response(config, root);
+    json_decref(root);
+
+    return success;
+}
+
+/**
+ * @brief Initialize the device cache from a recorded /devices document.
+ */
+int init_device_cache_from_json(const Config *config, const char *json,
+                                size_t json_size)
+{
+    if (!config)
+        return 0;
+
+    json_t *root = parse_devices_document(json, json_size);
+    if (!root)
         return 0;
+
+    const int success = process_device_cache_response(config, root);
+    json_decref(root);
+
+    return success;
+}
+
+/**
+ * @brief Merge devices that appeared since startup into the name cache.
+ * @details Rate-limited: refreshes at most every DEVICE_REFRESH_MIN_SEC, and
+ * the interval doubles up to DEVICE_REFRESH_MAX_SEC while refreshes find
+ * nothing new, so a UID /devices never lists costs little.
+ */
+int refresh_device_name_cache(void)
+{
+    const double now = monotonic_seconds();
+    if (device_names.refresh_interval < DEVICE_REFRESH_MIN_SEC)
+        device_names.refresh_interval = DEVICE_REFRESH_MIN_SEC;
+    if (device_names.last_refresh > 0.0 &&
+        now - device_names.last_refresh < device_names.refresh_interval)
+        return 0;
+
+    device_names.last_refresh = now;
+    json_t *root = fetch_devices_document();
+    if (!root)
+        return 0;
+
+    const int added =
+        populate_device_name_cache(json_object_get(root, "devices"));
+    json_decref(root);
+
+    if (added > 0)
+    {
+        device_names.refresh_interval = DEVICE_REFRESH_MIN_SEC;
+        log_message(LOG_STATUS, "Device cache refreshed: %d new device%s",
+                    added, added == 1 ? "" : "s");
+    }
+    else if (device_names.refresh_interval * 2.0 <= DEVICE_REFRESH_MAX_SEC)
+    {
+        device_names.refresh_interval *= 2.0;
+    }
+    else
+    {
+        device_names.refresh_interval = DEVICE_REFRESH_MAX_SEC;
     }
+    return added;
+}
 
-    http_response chunk = {0};
-    chunk.data = malloc(4096);
-    if (!chunk.data)
+/** @brief Check whether a /devices array lists a UID. */
+static int devices_list_uid(const json_t *devices, const char *uid)
+{
+    const size_t count = json_array_size(devices);
+    for (size_t i = 0; i < count; i++)
     {
-        curl_easy_cleanup(curl);
+        const json_t *uid_val = json_object_get(json_array_get(devices, i), "uid");
+        if (json_is_string(uid_val) && strcmp(json_string_value(uid_val), uid) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Re-validate the device caches after coolercontrold was unreachable.
+ * @details The LCD candidates are only read here: the upload stage uses them
+ * concurrently, so a changed LCD set is left to the reload.
+ */
+int revalidate_device_cache(void)
+{
+    json_t *root = fetch_devices_document();
+    if (!root)
+    {
+        log_message(LOG_WARNING, "Device cache re-validation failed");
         return 0;
     }
-    chunk.size = 0;
-    chunk.capacity = 4096;
 
-    struct curl_slist *headers = NULL;
-    configure_device_cache_curl(curl, config, url, &chunk, &headers);
+    const json_t *devices = json_object_get(root, "devices");
+    populate_device_name_cache(devices);
+    device_names.refresh_interval = DEVICE_REFRESH_MIN_SEC;
 
-    int success = 0;
-    if (curl_easy_perform(curl) == CURLE_OK)
+    for (int i = 0; i < device_cache.count; i++)
     {
-        success = process_device_cache_response(config, &chunk);
+        const lcd_device_t *lcd = &device_cache.devices[i];
+        if (!devices_list_uid(devices, lcd->device_uid))
+            log_message(LOG_WARNING,
+                        "LCD device %s [%s] no longer listed by CoolerControl; "
+                        "reload (SIGHUP) once it is back",
+                        lcd->device_name, lcd->device_uid);
     }
 
-    free(chunk.data);
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    json_decref(root);
+    return 1;
+}
 
-    return success;
+/**
+ * @brief Select the cached LCD device of a display config.
+ * @details A display with a device pattern takes the best candidate matching
+ * it, otherwise display N takes the N-th best candidate.
+ */
+static const lcd_device_t *select_lcd_device(const Config *config)
+{
+    if (config->display_device[0] != '\0')
+    {
+        for (int i = 0; i < device_cache.count; i++)
+        {
+            const lcd_device_t *lcd = &device_cache.devices[i];
+            if (pattern_list_matches(config->display_device, lcd->device_name,
+                                     lcd->device_type, lcd->device_uid))
+                return lcd;
+        }
+        return NULL;
+    }
+
+    return (config->display_index >= 0 &&
+            config->display_index < device_cache.count)
+               ? &device_cache.devices[config->display_index]
+               : NULL;
 }
 
 /**
@@ -797,23 +1026,26 @@ int get_cached_lcd_device_data(const Config *config, char *device_uid,
                                size_t name_size, int *screen_width,
                                int *screen_height)
 {
-    if (!initialize_device_cache(config))
-    {
+    // Read-only: filling the cache here would race the fetch stage
+    if (!config || !device_cache.initialized)
+        return 0;
+
+    const lcd_device_t *lcd = select_lcd_device(config);
+    if (!lcd)
         return 0;
-    }
 
     if (device_uid && uid_size > 0)
     {
-        cc_safe_strcpy(device_uid, uid_size, device_cache.device_uid);
+        cc_safe_strcpy(device_uid, uid_size, lcd->device_uid);
     }
     if (device_name && name_size > 0)
     {
-        cc_safe_strcpy(device_name, name_size, device_cache.device_name);
+        cc_safe_strcpy(device_name, name_size, lcd->device_name);
     }
     if (screen_width)
-        *screen_width = device_cache.screen_width;
+        *screen_width = lcd->screen_width;
     if (screen_height)
-        *screen_height = device_cache.screen_height;
+        *screen_height = lcd->screen_height;
 
     return 1;
 }
@@ -826,17 +1058,22 @@ int init_device_cache(const Config *config)
     return initialize_device_cache(config);
 }
 
+/**
+ * @brief Check whether the LCD candidate cache is initialized.
+ */
+int is_device_cache_initialized(void) { return device_cache.initialized; }
+
 /**
  * @brief Validate device cache dimensions.
  */
-static int validate_device_dimensions(void)
+static int validate_device_dimensions(const lcd_device_t *lcd)
 {
-    if (device_cache.screen_width <= 0 || device_cache.screen_height <= 0)
+    if (lcd->screen_width <= 0 || lcd->screen_height <= 0)
     {
         log_message(
             LOG_WARNING,
             "Device has invalid screen dimensions (%dx%d), using config values",
-            device_cache.screen_width, device_cache.screen_height);
+            lcd->screen_width, lcd->screen_height);
         return 0;
     }
     return 1;
@@ -902,14 +1139,23 @@ int update_config_from_device(Config *config)
         return 0;
     }
 
-    if (!validate_device_dimensions())
+    const lcd_device_t *lcd = select_lcd_device(config);
+    if (!lcd)
+    {
+        log_message(LOG_WARNING,
+                    "No LCD device for display %d, using config values as fallback",
+                    config->display_index + 1);
+        return 0;
+    }
+
+    if (!validate_device_dimensions(lcd))
         return 0;
 
     int updated = 0;
-    updated |= update_dimension(&config->display_width, device_cache.screen_width,
+    updated |= update_dimension(&config->display_width, lcd->screen_width,
                                 "width");
-    updated |= update_dimension(&config->display_height,
-                                device_cache.screen_height, "height");
+    updated |= update_dimension(&config->display_height, lcd->screen_height,
+                                "height");
 
     return updated;
 }
@@ -27,6 +27,15 @@
 // Basic constants
 #define CC_NAME_SIZE 128
 #define MAX_DEVICE_NAME_CACHE 32
+#define DEVICE_NAME_TABLE_SIZE (2 * MAX_DEVICE_NAME_CACHE)
+#define MAX_SENSOR_DEVICES 32
+#define MAX_SENSOR_DEVICE_RECORDS (2 * MAX_SENSOR_DEVICES)
+#define SENSOR_DEVICE_TABLE_SIZE (2 * MAX_SENSOR_DEVICES)
+#define SENSOR_DEVICE_UID_LEN 96
+#define SENSOR_DEVICE_TYPE_LEN 16
+#define DEVICE_REFRESH_MIN_SEC 30.0
+#define DEVICE_REFRESH_MAX_SEC 600.0
+#define MAX_LCD_CANDIDATES 8
 
 // Forward declarations
 struct Config;
@@ -41,8 +50,11 @@ int cc_safe_strcpy(char *restrict dest, size_t dest_size,
 
 /**
  * @brief Get cached LCD device information (UID, name, screen dimensions).
- * @details Reads the selected CoolerControl LCD device information from cache
- * without performing an additional API call.
+ * @details Reads the LCD device selected for this display config from cache
+ * without performing an additional API call. The device is matched by the
+ * display's device pattern, or by its position among the LCD candidates.
+ * Returns 0 until init_device_cache() succeeded; it never fills the cache,
+ * so any thread may call it while the pipeline runs.
  */
 int get_cached_lcd_device_data(const struct Config *config, char *device_uid,
                                size_t uid_size, char *device_name,
@@ -52,16 +64,54 @@ int get_cached_lcd_device_data(const struct Config *config, char *device_uid,
 /**
  * @brief Initialize device information cache.
  * @details Fetches and caches device information once at startup for better
- * performance.
+ * performance. Writes the device caches: call it from the main thread before
+ * the pipeline starts or while it is parked.
  */
 int init_device_cache(const struct Config *config);
 
+/** @brief Returns 1 once init_device_cache() found an LCD candidate. */
+int is_device_cache_initialized(void);
+
+/**
+ * @brief Initialize the device cache from a recorded /devices document.
+ * @details Same as init_device_cache() without a request; used by the render
+ * benchmark to replay fixtures offline.
+ * @param config Configuration with device detection settings
+ * @param json /devices response body
+ * @param json_size Length of json in bytes
+ * @return 1 if an LCD candidate was found, 0 otherwise
+ */
+int init_device_cache_from_json(const struct Config *config, const char *json,
+                                size_t json_size);
+
 /**
  * @brief Resets device cache for config reload (SIGHUP).
  * @details Clears all cached device data so it will be re-fetched from the API.
+ * Also drops the interned sensor devices, so the sensor state must be reset
+ * with it and no published sensor data may still be in use.
  */
 void reset_device_cache(void);
 
+/**
+ * @brief Refresh the device name cache for devices that appeared late.
+ * @details Fetches /devices again and adds UIDs the cache has not seen (e.g.
+ * after a USB re-enumeration); known entries are updated in place. Called
+ * from the fetch stage when /status reports an unknown UID. Rate-limited
+ * with backoff, so most calls return without a request.
+ * @return Number of devices added
+ */
+int refresh_device_name_cache(void);
+
+/**
+ * @brief Re-validate the device caches after coolercontrold was unreachable.
+ * @details Fetches /devices right away, bypassing the refresh backoff, merges
+ * new devices into the name cache and warns about cached LCDs the daemon no
+ * longer lists; those need a reload (SIGHUP) once they are back. Called from
+ * the fetch stage only.
+ * @return 1 if /devices was fetched, 0 otherwise
+ */
+int revalidate_device_cache(void);
+
 /**
  * @brief Update config with device screen dimensions (only if not set in
  * config.json).
@@ -82,8 +132,9 @@ int is_circular_display_device(const char *device_name, int screen_width,
 
 /**
  * @brief Get device display name by UID.
- * @details Retrieves the cached device name for a given UID.
- * Cache is populated during init_device_cache().
+ * @details Retrieves the cached device name for a given UID (hash lookup).
+ * Cache is populated during init_device_cache() and extended by
+ * refresh_device_name_cache().
  * @param device_uid Device UID to look up
  * @return Device name string, or empty string if not found
  */
@@ -97,6 +148,39 @@ const char *get_device_name_by_uid(const char *device_uid);
  */
 const char *get_device_type_by_uid(const char *device_uid);
 
+/**
+ * @brief Check whether a UID is in the device name cache.
+ * @return 1 if cached, 0 otherwise
+ */
+int is_device_uid_cached(const char *device_uid);
+
+/**
+ * @brief Interned metadata of a device that reports sensors.
+ * @details Shared by all sensor entries of the device. A record never changes
+ * once created: when the cached name or the reported type changes, a new
+ * record with the same id replaces it, so published sensor data can keep
+ * pointing at the old one. Records live until reset_device_cache().
+ */
+typedef struct
+{
+    int id;                                /**< Stable per UID across records */
+    char uid[SENSOR_DEVICE_UID_LEN];       /**< CC device UID */
+    char name[CC_NAME_SIZE];               /**< CC device name (e.g. "NZXT Kraken Z73") */
+    char type[SENSOR_DEVICE_TYPE_LEN];     /**< CC device type ("CPU","GPU","Liquidctl","Hwmon","CustomSensors") */
+} sensor_device_t;
+
+/**
+ * @brief Get the interned record of a device.
+ * @details Returns the current record of the UID, or creates one with the
+ * name from the device name cache. Called from the fetch stage (or the main
+ * thread before the pipeline starts) only.
+ * @param device_uid Device UID from /status
+ * @param device_type Device type from /status
+ * @return Record, or NULL if the UID is too long or the table is full
+ */
+const sensor_device_t *intern_sensor_device(const char *device_uid,
+                                            const char *device_type);
+
 /**
  * @brief Extract device type from JSON device object.
  * @details Checks "type" field first, falls back to "d_type" (used in /status).
@@ -19,6 +19,7 @@
 // cppcheck-suppress-begin missingIncludeSystem
 #include <curl/curl.h>
 #include <jansson.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -27,9 +28,38 @@
 
 // Include project headers
 #include "../device/config.h"
+#include "../device/stats.h"
 #include "cc_conf.h"
 #include "cc_main.h"
 
+/** @brief Frame-loop allocation counter, updated by all pipeline threads. */
+static struct
+{
+    pthread_mutex_t lock;
+    unsigned long count;
+} allocation_counter = {PTHREAD_MUTEX_INITIALIZER, 0};
+
+/**
+ * @brief Count a heap allocation of a frame-loop buffer.
+ */
+void cc_count_allocation(void)
+{
+    pthread_mutex_lock(&allocation_counter.lock);
+    allocation_counter.count++;
+    pthread_mutex_unlock(&allocation_counter.lock);
+}
+
+/**
+ * @brief Number of frame-loop buffer allocations so far.
+ */
+unsigned long get_allocation_count(void)
+{
+    pthread_mutex_lock(&allocation_counter.lock);
+    const unsigned long count = allocation_counter.count;
+    pthread_mutex_unlock(&allocation_counter.lock);
+    return count;
+}
+
 /**
  * @brief Initialize HTTP response buffer with specified capacity.
  * @details Allocates memory for HTTP response data with proper initialization.
@@ -50,12 +80,30 @@ int cc_init_response_buffer(http_response *response, size_t initial_capacity)
         return 0;
     }
 
+    cc_count_allocation();
     response->size = 0;
     response->capacity = initial_capacity;
     response->data[0] = '\0';
     return 1;
 }
 
+/**
+ * @brief Empty a long-lived response buffer, allocating it on first use.
+ * @details A buffer dropped by a failed reallocation is allocated again.
+ */
+int cc_reuse_response_buffer(http_response *response, size_t initial_capacity)
+{
+    if (!response)
+        return 0;
+
+    if (!response->data)
+        return cc_init_response_buffer(response, initial_capacity);
+
+    response->size = 0;
+    response->data[0] = '\0';
+    return 1;
+}
+
 /**
  * @brief Cleanup HTTP response buffer and free memory.
  * @details Properly frees allocated memory and resets buffer state.
@@ -76,15 +124,46 @@ void cc_cleanup_response_buffer(http_response *response)
     response->capacity = 0;
 }
 
+// Number of devices whose LCD endpoint URLs are cached
+#define CC_MAX_LCD_URLS 8
+
+// Preformatted LCD settings JSON body (mode, escaped image path, settings)
+#define CC_SETTINGS_BODY_SIZE (2 * CONFIG_MAX_PATH_LEN + 128)
+
+/**
+ * @brief Cached LCD endpoint URLs of one device.
+ * @details Also holds the settings JSON body of send_image_to_lcd(), rebuilt
+ * only when the image path, brightness or orientation change.
+ */
+typedef struct
+{
+    char device_uid[CC_UID_SIZE];
+    char settings_url[CC_URL_SIZE];
+    char images_url[CC_URL_SIZE];
+    char shutdown_url[CC_URL_SIZE];
+    char settings_body[CC_SETTINGS_BODY_SIZE];
+    char body_image_path[CONFIG_MAX_PATH_LEN];
+    int body_brightness; // -1 until the body is built
+    int body_orientation;
+} LcdEndpointUrls;
+
 /**
  * @brief Structure to hold CoolerControl session state.
- * @details Contains the CURL handle, cookie jar path, and session
- * initialization status.
+ * @details Contains the upload and probe CURL handles, the share handle pooling
+ * connections of all handles, prebuilt headers and cached endpoint URLs.
  */
 typedef struct
 {
     CURL *curl_handle;
+    CURL *probe_handle; // Health probe, used by the fetch stage only
+    CURLSH *share;
+    pthread_mutex_t share_locks[CURL_LOCK_DATA_LAST];
+    struct curl_slist *headers[CC_HEADERS_COUNT];
     char access_token[CC_BEARER_HEADER_SIZE];
+    char endpoint_urls[CC_ENDPOINT_COUNT][CC_URL_SIZE];
+    LcdEndpointUrls lcd_urls[CC_MAX_LCD_URLS];
+    int lcd_url_count;
+    http_response upload_response; // Reused by all upload requests
     int session_initialized;
 } CoolerControlSession;
 
@@ -96,6 +175,57 @@ typedef struct
 static CoolerControlSession cc_session = {
     .curl_handle = NULL, .access_token = {0}, .session_initialized = 0};
 
+// Handles that can own a transfer engine (upload, sensor, stream, device cache,
+// health probe, shutdown image, update check)
+#define CC_MAX_TRANSFER_HANDLES 7
+
+/** @brief curl_multi engine bound to one easy handle. */
+typedef struct
+{
+    CURL *easy;
+    CURLM *multi;
+} TransferEngine;
+
+/**
+ * @brief Transfer engines of all handles.
+ * @details Each engine is only driven by the thread owning its easy handle;
+ * the lock guards registration and cross-thread wakeups. aborted fails the
+ * transfers of all threads, aborted_thread only those of one thread.
+ */
+static struct
+{
+    pthread_mutex_t lock;
+    TransferEngine engines[CC_MAX_TRANSFER_HANDLES];
+    int aborted;
+    int thread_aborted;
+    pthread_t aborted_thread;
+} transfers = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+/** @brief Connection reuse counters, updated by the fetch and upload threads. */
+static struct
+{
+    pthread_mutex_t lock;
+    cc_connection_stats totals;
+} connection_stats = {PTHREAD_MUTEX_INITIALIZER, {0, 0, 0}};
+
+/**
+ * @brief Circuit breaker of all coolercontrold requests.
+ * @details failures counts consecutive failed requests; at
+ * CC_BREAKER_FAILURE_THRESHOLD the breaker opens and requests fail at once
+ * until the fetch stage's health probe, due at retry_at_ns, succeeds. Updated
+ * by every thread that runs transfers.
+ */
+static struct
+{
+    pthread_mutex_t lock;
+    int failures;
+    int open;
+    long backoff_ms;
+    uint64_t opened_at_ns;
+    uint64_t retry_at_ns;
+    uint32_t jitter_state;
+} breaker = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
 /**
  * @brief Reallocate response buffer if needed.
  * @details Grows buffer capacity using exponential growth strategy.
@@ -120,6 +250,7 @@ static int reallocate_response_buffer(http_response *response,
         return 0;
     }
 
+    cc_count_allocation();
     response->data = ptr;
     response->capacity = new_capacity;
     return 1;
@@ -166,10 +297,181 @@ static int validate_snprintf(int written, size_t buffer_size, char *buffer)
     return 1;
 }
 
+/** @brief Share handle lock callback; one mutex per shared data type. */
+static void lock_share_data(CURL *handle, curl_lock_data data,
+                            curl_lock_access access, void *userptr)
+{
+    (void)handle;
+    (void)access;
+    (void)userptr;
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+        pthread_mutex_lock(&cc_session.share_locks[data]);
+}
+
+/** @brief Share handle unlock callback. */
+static void unlock_share_data(CURL *handle, curl_lock_data data, void *userptr)
+{
+    (void)handle;
+    (void)userptr;
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+        pthread_mutex_unlock(&cc_session.share_locks[data]);
+}
+
+/**
+ * @brief Create the share handle pooling connections, DNS and TLS sessions.
+ * @details Handles used from different threads (sensor fetch, LCD upload)
+ * reuse the same keep-alive connections to coolercontrold.
+ */
+static int init_connection_share(void)
+{
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++)
+        pthread_mutex_init(&cc_session.share_locks[i], NULL);
+
+    cc_session.share = curl_share_init();
+    if (!cc_session.share)
+    {
+        for (int i = 0; i < CURL_LOCK_DATA_LAST; i++)
+            pthread_mutex_destroy(&cc_session.share_locks[i]);
+        return 0;
+    }
+
+    curl_share_setopt(cc_session.share, CURLSHOPT_LOCKFUNC, lock_share_data);
+    curl_share_setopt(cc_session.share, CURLSHOPT_UNLOCKFUNC, unlock_share_data);
+    curl_share_setopt(cc_session.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    curl_share_setopt(cc_session.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(cc_session.share, CURLSHOPT_SHARE,
+                      CURL_LOCK_DATA_SSL_SESSION);
+    return 1;
+}
+
+/**
+ * @brief Release the upload and probe handles, share, headers and cached URLs.
+ * @details All other handles attached to the share must already be freed.
+ */
+static void release_session_resources(void)
+{
+    if (cc_session.curl_handle)
+    {
+        cc_release_easy_handle(cc_session.curl_handle);
+        cc_session.curl_handle = NULL;
+    }
+
+    if (cc_session.probe_handle)
+    {
+        cc_release_easy_handle(cc_session.probe_handle);
+        cc_session.probe_handle = NULL;
+    }
+
+    if (cc_session.share)
+    {
+        if (curl_share_cleanup(cc_session.share) != CURLSHE_OK)
+            log_message(LOG_WARNING, "CURL share handle still in use");
+        cc_session.share = NULL;
+        for (int i = 0; i < CURL_LOCK_DATA_LAST; i++)
+            pthread_mutex_destroy(&cc_session.share_locks[i]);
+    }
+
+    for (int i = 0; i < CC_HEADERS_COUNT; i++)
+    {
+        if (cc_session.headers[i])
+        {
+            curl_slist_free_all(cc_session.headers[i]);
+            cc_session.headers[i] = NULL;
+        }
+    }
+
+    cc_cleanup_response_buffer(&cc_session.upload_response);
+    memset(cc_session.endpoint_urls, 0, sizeof(cc_session.endpoint_urls));
+    cc_session.lcd_url_count = 0;
+    cc_session.session_initialized = 0;
+    cc_session.access_token[0] = '\0';
+}
+
+/** @brief Log how many requests reused a kept-alive connection. */
+static void log_connection_stats(void)
+{
+    cc_connection_stats stats;
+    get_connection_stats(&stats);
+    if (stats.requests == 0)
+        return;
+
+    log_message(LOG_INFO,
+                "HTTP connection reuse: %lu of %lu requests (%lu connections opened)",
+                stats.reused, stats.requests, stats.connections);
+}
+
+/**
+ * @brief Build the header lists shared by all requests of the session.
+ * @details Built once per session instead of once per request.
+ */
+static int build_session_headers(void)
+{
+    struct curl_slist *defaults = NULL;
+    defaults = curl_slist_append(defaults, "Accept: application/json");
+    if (defaults)
+        defaults = curl_slist_append(defaults, "User-Agent: CoolerDash/1.0");
+    if (defaults)
+        defaults = curl_slist_append(defaults, cc_session.access_token);
+    cc_session.headers[CC_HEADERS_DEFAULT] = defaults;
+
+    struct curl_slist *json = NULL;
+    json = curl_slist_append(json, "Content-Type: application/json");
+    if (json)
+        json = curl_slist_append(json, "Accept: application/json");
+    if (json)
+        json = curl_slist_append(json, "User-Agent: CoolerDash/1.0");
+    if (json)
+        json = curl_slist_append(json, cc_session.access_token);
+    cc_session.headers[CC_HEADERS_JSON] = json;
+
+    struct curl_slist *events = NULL;
+    events = curl_slist_append(events, "Accept: text/event-stream");
+    if (events)
+        events = curl_slist_append(events, "User-Agent: CoolerDash/1.0");
+    if (events)
+        events = curl_slist_append(events, cc_session.access_token);
+    cc_session.headers[CC_HEADERS_EVENT_STREAM] = events;
+
+    return defaults && json && events;
+}
+
+/**
+ * @brief Resolve the fixed endpoint URLs of the configured daemon address.
+ */
+static int build_endpoint_urls(const Config *config)
+{
+    static const char *const paths[CC_ENDPOINT_COUNT] = {
+        "/status", "/devices", "/sse/status", "/handshake"};
+
+    for (int i = 0; i < CC_ENDPOINT_COUNT; i++)
+    {
+        char *url = cc_session.endpoint_urls[i];
+        int written = snprintf(url, CC_URL_SIZE, "%s%s",
+                               config->daemon_address, paths[i]);
+        if (!validate_snprintf(written, CC_URL_SIZE, url))
+            return 0;
+    }
+    return 1;
+}
+
+/** @brief Apply keep-alive and pooling options shared by all handles. */
+static void apply_connection_options(CURL *curl)
+{
+    if (cc_session.share)
+        curl_easy_setopt(curl, CURLOPT_SHARE, cc_session.share);
+
+    // Worker threads must not get SIGALRM from DNS timeouts
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, 30L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, 15L);
+}
+
 /**
  * @brief Initializes the CoolerControl session (CURL setup and login).
- * @details This function initializes the CURL library and stores the Bearer
- * authorization header used for all CoolerControl API requests.
+ * @details This function initializes the CURL library, the shared connection
+ * pool, and the Bearer authorization header used for all CoolerControl API
+ * requests.
  */
 int init_coolercontrol_session(const Config *config)
 {
@@ -181,22 +483,49 @@ int init_coolercontrol_session(const Config *config)
     }
 
     curl_global_init(CURL_GLOBAL_DEFAULT);
-    cc_session.curl_handle = curl_easy_init();
+
+    pthread_mutex_lock(&transfers.lock);
+    transfers.aborted = 0;
+    pthread_mutex_unlock(&transfers.lock);
+
+    // A new session (startup, SIGHUP) starts with a closed breaker
+    pthread_mutex_lock(&breaker.lock);
+    breaker.failures = 0;
+    breaker.open = 0;
+    pthread_mutex_unlock(&breaker.lock);
+
+    if (!init_connection_share())
+    {
+        log_message(LOG_ERROR, "Failed to initialize CURL share handle");
+        release_session_resources();
+        return 0;
+    }
+
+    cc_session.curl_handle = cc_create_easy_handle();
     if (!cc_session.curl_handle)
+    {
+        release_session_resources();
         return 0;
+    }
 
     int written = snprintf(cc_session.access_token, sizeof(cc_session.access_token),
                            "Authorization: Bearer %s", config->access_token);
     if (!validate_snprintf(written, sizeof(cc_session.access_token),
                            cc_session.access_token))
     {
-        curl_easy_cleanup(cc_session.curl_handle);
-        cc_session.curl_handle = NULL;
+        release_session_resources();
         curl_global_cleanup();
         log_message(LOG_ERROR, "Access token header exceeds maximum size");
         return 0;
     }
 
+    if (!build_session_headers() || !build_endpoint_urls(config))
+    {
+        release_session_resources();
+        log_message(LOG_ERROR, "Failed to prepare CoolerControl request headers/URLs");
+        return 0;
+    }
+
     cc_session.session_initialized = 1;
     log_message(LOG_STATUS, "Session initialized using Bearer token");
     return 1;
@@ -222,20 +551,14 @@ void cleanup_coolercontrol_session(void)
 
     int all_cleaned = 1;
 
-    // Clean up CURL handle
-    if (cc_session.curl_handle)
-    {
-        curl_easy_cleanup(cc_session.curl_handle);
-        cc_session.curl_handle = NULL;
-    }
+    log_connection_stats();
+
+    // Clean up CURL handles, share, headers and URLs; marks session uninitialized
+    release_session_resources();
 
     // Perform global CURL cleanup
     curl_global_cleanup();
 
-    // Mark session as uninitialized
-    cc_session.session_initialized = 0;
-    cc_session.access_token[0] = '\0';
-
     // Set cleanup flag only if all operations succeeded
     if (all_cleaned)
     {
@@ -251,14 +574,8 @@ void cleanup_coolercontrol_session(void)
  */
 void reset_coolercontrol_session(void)
 {
-    if (cc_session.curl_handle)
-    {
-        curl_easy_cleanup(cc_session.curl_handle);
-        cc_session.curl_handle = NULL;
-    }
-
-    cc_session.session_initialized = 0;
-    cc_session.access_token[0] = '\0';
+    log_connection_stats();
+    release_session_resources();
 }
 
 /**
@@ -269,6 +586,496 @@ const char *get_session_access_token(void)
     return cc_session.access_token;
 }
 
+/**
+ * @brief Create a CURL easy handle attached to the shared connection pool.
+ */
+CURL *cc_create_easy_handle(void)
+{
+    CURL *curl = curl_easy_init();
+    if (!curl)
+    {
+        log_message(LOG_ERROR, "Failed to initialize CURL handle");
+        return NULL;
+    }
+
+    apply_connection_options(curl);
+    return curl;
+}
+
+/**
+ * @brief Free a handle from cc_create_easy_handle() and its transfer engine.
+ */
+void cc_release_easy_handle(CURL *curl)
+{
+    if (!curl)
+        return;
+
+    pthread_mutex_lock(&transfers.lock);
+    for (int i = 0; i < CC_MAX_TRANSFER_HANDLES; i++)
+    {
+        TransferEngine *engine = &transfers.engines[i];
+        if (engine->easy == curl)
+        {
+            curl_multi_cleanup(engine->multi);
+            engine->easy = NULL;
+            engine->multi = NULL;
+        }
+    }
+    pthread_mutex_unlock(&transfers.lock);
+
+    curl_easy_cleanup(curl);
+}
+
+/** @brief Check whether the calling thread's transfers are aborted. Caller holds the lock. */
+static int caller_aborted(void)
+{
+    return transfers.aborted ||
+           (transfers.thread_aborted &&
+            pthread_equal(transfers.aborted_thread, pthread_self()));
+}
+
+/**
+ * @brief Return the transfer engine of a handle, creating it on first use.
+ * @details Returns NULL if transfers are aborted. If all engines are taken,
+ * *fallback is set and the caller runs the transfer with curl_easy_perform().
+ */
+static CURLM *get_transfer_engine(CURL *curl, int *fallback)
+{
+    CURLM *multi = NULL;
+    *fallback = 0;
+
+    pthread_mutex_lock(&transfers.lock);
+    if (!caller_aborted())
+    {
+        TransferEngine *free_engine = NULL;
+        for (int i = 0; i < CC_MAX_TRANSFER_HANDLES && !multi; i++)
+        {
+            TransferEngine *engine = &transfers.engines[i];
+            if (engine->easy == curl)
+                multi = engine->multi;
+            else if (!engine->easy && !free_engine)
+                free_engine = engine;
+        }
+
+        if (!multi && free_engine)
+        {
+            free_engine->multi = curl_multi_init();
+            if (free_engine->multi)
+            {
+                free_engine->easy = curl;
+                multi = free_engine->multi;
+            }
+        }
+        *fallback = (multi == NULL);
+    }
+    pthread_mutex_unlock(&transfers.lock);
+
+    return multi;
+}
+
+/** @brief Returns 1 once the calling thread's transfers were aborted. */
+static int transfers_aborted(void)
+{
+    pthread_mutex_lock(&transfers.lock);
+    const int aborted = caller_aborted();
+    pthread_mutex_unlock(&transfers.lock);
+    return aborted;
+}
+
+/**
+ * @brief Next value of the backoff jitter generator (xorshift32). Caller holds
+ * the breaker lock.
+ */
+static uint32_t next_jitter(void)
+{
+    uint32_t x = breaker.jitter_state;
+    if (x == 0)
+        x = (uint32_t)stats_clock_ns() ^ ((uint32_t)getpid() << 16) ^ 0x9e3779b9u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    breaker.jitter_state = x;
+    return x;
+}
+
+/**
+ * @brief Schedule the next health probe. Caller holds the breaker lock.
+ * @details Equal jitter: half the backoff plus a random part of the other
+ * half, so several CoolerDash instances do not probe a restarting daemon in
+ * lockstep.
+ * @return Delay until the probe in milliseconds
+ */
+static long schedule_probe(uint64_t now_ns)
+{
+    const long half = breaker.backoff_ms / 2;
+    const long delay_ms = half + (long)(next_jitter() % (uint32_t)(half + 1));
+    breaker.retry_at_ns = now_ns + (uint64_t)delay_ms * 1000000ULL;
+    return delay_ms;
+}
+
+/**
+ * @brief Check whether a transfer went to a daemon health endpoint.
+ * @details /status, /devices and /handshake only fail with HTTP 5xx when
+ * coolercontrold itself is broken; an LCD upload or settings 5xx is a device
+ * error and says nothing about the daemon.
+ */
+static int is_health_endpoint(CURL *curl)
+{
+    static const cc_endpoint health[] = {CC_ENDPOINT_STATUS, CC_ENDPOINT_DEVICES,
+                                         CC_ENDPOINT_HANDSHAKE};
+    const char *url = NULL;
+    if (curl_easy_getinfo(curl, CURLINFO_EFFECTIVE_URL, &url) != CURLE_OK || !url)
+        return 0;
+
+    for (size_t i = 0; i < sizeof(health) / sizeof(health[0]); i++)
+    {
+        if (strcmp(url, cc_session.endpoint_urls[health[i]]) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Classify a finished coolercontrold transfer for the breaker.
+ * @details Only errors that mean the daemon is down or hanging count as
+ * failures: connection errors and timeouts on any endpoint, HTTP 5xx on the
+ * health endpoints. Other 5xx answers and local errors (aborts, callbacks,
+ * bad options) count as neither.
+ * @return 1 if failed, 0 if the daemon answered, -1 if not counted
+ */
+static int transfer_outcome(CURL *curl, CURLcode result)
+{
+    switch (result)
+    {
+    case CURLE_OK:
+    {
+        long http_code = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+        if (http_code < 500)
+            return 0;
+        return is_health_endpoint(curl) ? 1 : -1;
+    }
+    case CURLE_COULDNT_RESOLVE_HOST:
+    case CURLE_COULDNT_CONNECT:
+    case CURLE_OPERATION_TIMEDOUT:
+    case CURLE_SEND_ERROR:
+    case CURLE_RECV_ERROR:
+    case CURLE_GOT_NOTHING:
+    case CURLE_PARTIAL_FILE:
+    case CURLE_SSL_CONNECT_ERROR:
+        return 1;
+    default:
+        return -1;
+    }
+}
+
+/** @brief Count a transfer result; opens the breaker at the failure threshold. */
+static void record_breaker_outcome(CURL *curl, CURLcode result)
+{
+    const int outcome = transfer_outcome(curl, result);
+    if (outcome < 0)
+        return;
+
+    pthread_mutex_lock(&breaker.lock);
+    if (outcome == 0)
+    {
+        breaker.failures = 0;
+        pthread_mutex_unlock(&breaker.lock);
+        return;
+    }
+
+    long delay_ms = 0;
+    const int opened = !breaker.open &&
+                       ++breaker.failures >= CC_BREAKER_FAILURE_THRESHOLD;
+    if (opened)
+    {
+        const uint64_t now_ns = stats_clock_ns();
+        breaker.open = 1;
+        breaker.opened_at_ns = now_ns;
+        breaker.backoff_ms = CC_BREAKER_MIN_BACKOFF_MS;
+        delay_ms = schedule_probe(now_ns);
+    }
+    const int failures = breaker.failures;
+    pthread_mutex_unlock(&breaker.lock);
+
+    if (!opened)
+        return;
+
+    char reason[96];
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    if (result == CURLE_OK)
+        snprintf(reason, sizeof(reason), "HTTP %ld", http_code);
+    else
+        snprintf(reason, sizeof(reason), "CURL %d: %s", (int)result,
+                 curl_easy_strerror(result));
+    log_message(LOG_WARNING,
+                "CoolerControl unreachable after %d failed requests (%s), "
+                "pausing updates; next probe in %.1fs",
+                failures, reason, (double)delay_ms / 1000.0);
+}
+
+/** @brief Returns 1 while the breaker is open. */
+static int breaker_is_open(void)
+{
+    pthread_mutex_lock(&breaker.lock);
+    const int open = breaker.open;
+    pthread_mutex_unlock(&breaker.lock);
+    return open;
+}
+
+/**
+ * @brief Run a transfer on the handle's curl_multi engine with a deadline.
+ */
+static CURLcode run_transfer(CURL *curl, long timeout_ms)
+{
+    if (!curl)
+        return CURLE_BAD_FUNCTION_ARGUMENT;
+
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, timeout_ms > 0 ? timeout_ms : 0L);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS,
+                     timeout_ms > 0 ? timeout_ms : CC_MAX_DEADLINE_MS);
+
+    int fallback = 0;
+    CURLM *multi = get_transfer_engine(curl, &fallback);
+    if (!multi)
+        return fallback ? curl_easy_perform(curl) : CURLE_ABORTED_BY_CALLBACK;
+
+    if (curl_multi_add_handle(multi, curl) != CURLM_OK)
+        return curl_easy_perform(curl);
+
+    CURLcode result = CURLE_ABORTED_BY_CALLBACK;
+    int running = 1;
+    while (running)
+    {
+        if (curl_multi_perform(multi, &running) != CURLM_OK)
+        {
+            result = CURLE_RECV_ERROR;
+            break;
+        }
+
+        if (!running)
+        {
+            // Transfer finished: fetch its result (deadline misses included)
+            int queued = 0;
+            const CURLMsg *msg;
+            while ((msg = curl_multi_info_read(multi, &queued)) != NULL)
+            {
+                if (msg->msg == CURLMSG_DONE && msg->easy_handle == curl)
+                    result = msg->data.result;
+            }
+            break;
+        }
+
+        // curl shortens the wait to its own timers; wakeups end it early
+        if (curl_multi_poll(multi, NULL, 0, 1000, NULL) != CURLM_OK)
+        {
+            result = CURLE_RECV_ERROR;
+            break;
+        }
+
+        if (transfers_aborted())
+            break;
+    }
+
+    curl_multi_remove_handle(multi, curl);
+    return result;
+}
+
+/**
+ * @brief Run a coolercontrold transfer through the circuit breaker.
+ * @details The health probe passes an open breaker; its result is handled by
+ * cc_check_circuit().
+ */
+CURLcode cc_perform_transfer(CURL *curl, long timeout_ms)
+{
+    const int probe = curl && curl == cc_session.probe_handle;
+    if (curl && !probe && breaker_is_open())
+        return CURLE_COULDNT_CONNECT;
+
+    const CURLcode result = run_transfer(curl, timeout_ms);
+    if (curl && !probe)
+        record_breaker_outcome(curl, result);
+    return result;
+}
+
+/**
+ * @brief Run a transfer to a host other than coolercontrold.
+ */
+CURLcode cc_perform_external_transfer(CURL *curl, long timeout_ms)
+{
+    return run_transfer(curl, timeout_ms);
+}
+
+/**
+ * @brief Abort running transfers and fail new ones until the next session.
+ */
+void cc_abort_transfers(void)
+{
+    pthread_mutex_lock(&transfers.lock);
+    transfers.aborted = 1;
+    for (int i = 0; i < CC_MAX_TRANSFER_HANDLES; i++)
+    {
+        if (transfers.engines[i].multi)
+            curl_multi_wakeup(transfers.engines[i].multi);
+    }
+    pthread_mutex_unlock(&transfers.lock);
+}
+
+/**
+ * @brief Abort the transfers of one thread and fail its new ones.
+ * @details Engines are not tracked per thread, so all are woken; the others
+ * see that they are not aborted and keep waiting.
+ */
+void cc_abort_thread_transfers(pthread_t thread)
+{
+    pthread_mutex_lock(&transfers.lock);
+    transfers.thread_aborted = 1;
+    transfers.aborted_thread = thread;
+    for (int i = 0; i < CC_MAX_TRANSFER_HANDLES; i++)
+    {
+        if (transfers.engines[i].multi)
+            curl_multi_wakeup(transfers.engines[i].multi);
+    }
+    pthread_mutex_unlock(&transfers.lock);
+}
+
+/**
+ * @brief Lift cc_abort_thread_transfers() once the thread was joined.
+ */
+void cc_clear_thread_abort(void)
+{
+    pthread_mutex_lock(&transfers.lock);
+    transfers.thread_aborted = 0;
+    pthread_mutex_unlock(&transfers.lock);
+}
+
+/**
+ * @brief Deadline of one sensor fetch or LCD upload.
+ */
+long cc_request_deadline_ms(const Config *config)
+{
+    if (!config)
+        return CC_MAX_DEADLINE_MS;
+
+    const long interval_ms = (long)(config->display_refresh_interval * 1000.0f);
+    if (interval_ms < CC_MIN_DEADLINE_MS)
+        return CC_MIN_DEADLINE_MS;
+    if (interval_ms > CC_MAX_DEADLINE_MS)
+        return CC_MAX_DEADLINE_MS;
+    return interval_ms;
+}
+
+/**
+ * @brief Returns the cached URL of an endpoint (empty if no session).
+ */
+const char *get_session_url(cc_endpoint endpoint)
+{
+    if (endpoint < 0 || endpoint >= CC_ENDPOINT_COUNT)
+        return "";
+    return cc_session.endpoint_urls[endpoint];
+}
+
+/**
+ * @brief Returns a prebuilt header list for CURLOPT_HTTPHEADER.
+ */
+struct curl_slist *get_session_headers(cc_header_set set)
+{
+    if (set < 0 || set >= CC_HEADERS_COUNT)
+        return NULL;
+    return cc_session.headers[set];
+}
+
+/**
+ * @brief Account a finished transfer in the connection reuse counters.
+ * @details CURLINFO_NUM_CONNECTS is 0 when the transfer reused a pooled
+ * connection. New connections after the first request are logged in verbose
+ * mode, since they mean coolercontrold closed the kept-alive connection.
+ */
+void cc_record_transfer(CURL *curl)
+{
+    long new_connections = 0;
+    if (!curl ||
+        curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &new_connections) != CURLE_OK)
+        new_connections = 0;
+
+    pthread_mutex_lock(&connection_stats.lock);
+    connection_stats.totals.requests++;
+    if (new_connections > 0)
+        connection_stats.totals.connections += (unsigned long)new_connections;
+    else
+        connection_stats.totals.reused++;
+    const cc_connection_stats snapshot = connection_stats.totals;
+    pthread_mutex_unlock(&connection_stats.lock);
+
+    if (new_connections > 0 && snapshot.requests > 1)
+        log_message(LOG_INFO,
+                    "HTTP: new connection to CoolerControl (%lu of %lu requests reused)",
+                    snapshot.reused, snapshot.requests);
+}
+
+/**
+ * @brief Copy the connection reuse counters (thread-safe).
+ */
+void get_connection_stats(cc_connection_stats *stats)
+{
+    if (!stats)
+        return;
+
+    pthread_mutex_lock(&connection_stats.lock);
+    *stats = connection_stats.totals;
+    pthread_mutex_unlock(&connection_stats.lock);
+}
+
+/**
+ * @brief Returns the cached LCD endpoint URLs of a device.
+ * @details Built on first use per device. Only the upload path (upload thread,
+ * or the main thread before the pipeline starts) calls this.
+ */
+static LcdEndpointUrls *get_lcd_urls(const Config *config,
+                                     const char *device_uid)
+{
+    for (int i = 0; i < cc_session.lcd_url_count; i++)
+    {
+        if (strcmp(cc_session.lcd_urls[i].device_uid, device_uid) == 0)
+            return &cc_session.lcd_urls[i];
+    }
+
+    // Table full: reuse the last entry
+    const int index = (cc_session.lcd_url_count < CC_MAX_LCD_URLS)
+                          ? cc_session.lcd_url_count
+                          : CC_MAX_LCD_URLS - 1;
+    LcdEndpointUrls *urls = &cc_session.lcd_urls[index];
+    const char *base = config->daemon_address;
+
+    int ok = validate_snprintf(
+        snprintf(urls->settings_url, sizeof(urls->settings_url),
+                 "%s/devices/%s/settings/lcd/lcd?log=false", base, device_uid),
+        sizeof(urls->settings_url), urls->settings_url);
+    ok = ok && validate_snprintf(
+                   snprintf(urls->images_url, sizeof(urls->images_url),
+                            "%s/devices/%s/settings/lcd/lcd/images?log=false",
+                            base, device_uid),
+                   sizeof(urls->images_url), urls->images_url);
+    ok = ok && validate_snprintf(
+                   snprintf(urls->shutdown_url, sizeof(urls->shutdown_url),
+                            "%s/devices/%s/settings/lcd/lcd/shutdown-image",
+                            base, device_uid),
+                   sizeof(urls->shutdown_url), urls->shutdown_url);
+    if (!ok || strlen(device_uid) >= sizeof(urls->device_uid))
+    {
+        if (index < cc_session.lcd_url_count)
+            cc_session.lcd_url_count = index; // drop the overwritten entry
+        return NULL;
+    }
+
+    cc_safe_strcpy(urls->device_uid, sizeof(urls->device_uid), device_uid);
+    urls->body_brightness = -1;
+    if (index == cc_session.lcd_url_count)
+        cc_session.lcd_url_count++;
+    return urls;
+}
+
 /**
  * @brief Reset CURL options after a request to prepare for the next one.
  * @details Clears all request-specific CURL options (URL, body, headers, etc.).
@@ -309,6 +1116,17 @@ static int check_upload_response(CURLcode res, long http_response_code,
     if (res == CURLE_OK && http_response_code == 200)
         return 1;
 
+    if (res == CURLE_ABORTED_BY_CALLBACK)
+    {
+        log_message(LOG_INFO, "LCD upload aborted");
+        return 0;
+    }
+    if (res == CURLE_OPERATION_TIMEDOUT)
+    {
+        log_message(LOG_WARNING, "LCD upload exceeded its deadline, frame skipped");
+        return 0;
+    }
+
     log_message(LOG_ERROR, "LCD upload failed: CURL code %d, HTTP code %ld", res,
                 http_response_code);
     if (response->data && response->size > 0)
@@ -320,33 +1138,26 @@ static int check_upload_response(CURLcode res, long http_response_code,
 }
 
 /**
- * @brief Sends an image path to the LCD display via JSON settings endpoint.
- * @details Instead of uploading the full image binary via multipart, this sends
- * the file path to CoolerControl which reads the image directly from disk.
- * Uses PUT /devices/{uid}/settings/lcd/lcd with LcdSettings JSON body.
+ * @brief Returns the LCD settings JSON body of a device.
+ * @details Serialized with jansson (path escaping) into the device's URL
+ * cache entry and reused until the image path, brightness or orientation
+ * change.
+ * @return Body string, or NULL on failure
  */
-int send_image_to_lcd(const Config *config, const char *image_path,
-                      const char *device_uid)
+static const char *get_lcd_settings_body(const Config *config,
+                                         LcdEndpointUrls *urls,
+                                         const char *image_path)
 {
-    if (!validate_upload_params(image_path, device_uid))
-        return 0;
-
-    char upload_url[CC_URL_SIZE];
-    int written = snprintf(upload_url, sizeof(upload_url),
-                           "%s/devices/%s/settings/lcd/lcd?log=false",
-                           config->daemon_address, device_uid);
-    if (!validate_snprintf(written, sizeof(upload_url), upload_url))
-    {
-        log_message(LOG_ERROR, "LCD settings URL truncated");
-        return 0;
-    }
+    if (urls->body_brightness == (int)config->lcd_brightness &&
+        urls->body_orientation == (int)config->lcd_orientation &&
+        strcmp(urls->body_image_path, image_path) == 0)
+        return urls->settings_body;
 
-    // Build JSON body: LcdSettings with image_file_processed path
     json_t *body = json_object();
     if (!body)
     {
         log_message(LOG_ERROR, "Failed to create JSON object for LCD settings");
-        return 0;
+        return NULL;
     }
 
     json_object_set_new(body, "mode", json_string("image"));
@@ -355,94 +1166,91 @@ int send_image_to_lcd(const Config *config, const char *image_path,
     json_object_set_new(body, "orientation", json_integer(config->lcd_orientation));
     json_object_set_new(body, "colors", json_array());
 
-    char *json_str = json_dumps(body, JSON_COMPACT);
+    urls->body_brightness = -1;
+    const size_t length = json_dumpb(body, urls->settings_body,
+                                     sizeof(urls->settings_body) - 1,
+                                     JSON_COMPACT);
     json_decref(body);
-    if (!json_str)
+    if (length == 0 || length >= sizeof(urls->settings_body))
     {
         log_message(LOG_ERROR, "Failed to serialize LCD settings JSON");
+        return NULL;
+    }
+
+    cc_count_allocation();
+    urls->settings_body[length] = '\0';
+    cc_safe_strcpy(urls->body_image_path, sizeof(urls->body_image_path),
+                   image_path);
+    urls->body_brightness = (int)config->lcd_brightness;
+    urls->body_orientation = (int)config->lcd_orientation;
+    return urls->settings_body;
+}
+
+/**
+ * @brief Sends an image path to the LCD display via JSON settings endpoint.
+ * @details Instead of uploading the full image binary via multipart, this sends
+ * the file path to CoolerControl which reads the image directly from disk.
+ * Uses PUT /devices/{uid}/settings/lcd/lcd with LcdSettings JSON body.
+ */
+int send_image_to_lcd(const Config *config, const char *image_path,
+                      const char *device_uid)
+{
+    if (!validate_upload_params(image_path, device_uid))
+        return 0;
+
+    LcdEndpointUrls *urls = get_lcd_urls(config, device_uid);
+    if (!urls)
+    {
+        log_message(LOG_ERROR, "LCD settings URL truncated");
         return 0;
     }
 
-    http_response response = {0};
-    if (!cc_init_response_buffer(&response, 4096))
+    const char *json_str = get_lcd_settings_body(config, urls, image_path);
+    if (!json_str)
+        return 0;
+
+    http_response *response = &cc_session.upload_response;
+    if (!cc_reuse_response_buffer(response, 4096))
     {
         log_message(LOG_ERROR, "Failed to initialize response buffer");
-        free(json_str);
         return 0;
     }
 
     // Configure CURL for JSON PUT request
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_URL, upload_url);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_URL, urls->settings_url);
     curl_easy_setopt(cc_session.curl_handle, CURLOPT_CUSTOMREQUEST, "PUT");
     curl_easy_setopt(cc_session.curl_handle, CURLOPT_POSTFIELDS, json_str);
     curl_easy_setopt(
         cc_session.curl_handle, CURLOPT_WRITEFUNCTION,
         (size_t (*)(const void *, size_t, size_t, void *))write_callback);
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_WRITEDATA, &response);
-
-    struct curl_slist *headers = NULL;
-    headers = curl_slist_append(headers, "Content-Type: application/json");
-    headers = curl_slist_append(headers, "User-Agent: CoolerDash/1.0");
-    headers = curl_slist_append(headers, "Accept: application/json");
-    headers = curl_slist_append(headers, cc_session.access_token);
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_HTTPHEADER,
+                     cc_session.headers[CC_HEADERS_JSON]);
 
-    CURLcode res = curl_easy_perform(cc_session.curl_handle);
+    CURLcode res = cc_perform_transfer(cc_session.curl_handle,
+                                       cc_request_deadline_ms(config));
+    cc_record_transfer(cc_session.curl_handle);
     long http_response_code = -1;
     curl_easy_getinfo(cc_session.curl_handle, CURLINFO_RESPONSE_CODE,
                       &http_response_code);
 
-    int success = check_upload_response(res, http_response_code, &response);
+    int success = check_upload_response(res, http_response_code, response);
 
-    // Cleanup
-    cc_cleanup_response_buffer(&response);
-    if (headers)
-        curl_slist_free_all(headers);
-    free(json_str);
     reset_curl_request_options();
 
     return success;
 }
 
 /**
- * @brief Register shutdown image with CoolerControl's native LCD shutdown image API.
- * @details Uploads the shutdown PNG to CC at daemon startup via multipart PUT to
- *          /devices/{uid}/settings/lcd/lcd/shutdown-image.
- *          CC stores the image internally and applies it automatically when the
- *          CC daemon shuts down. Handles 404 gracefully (CC version too old).
+ * @brief Build the multipart LCD settings form without the image part.
+ * @details Adds the mode, brightness and orientation fields. curl copies the
+ * field data, so the form does not reference local buffers.
  */
-int register_lcd_shutdown_image_with_cc(const Config *config,
-                                        const char *image_path,
-                                        const char *device_uid)
+static curl_mime *build_lcd_image_mime(CURL *curl, const Config *config)
 {
-    if (!validate_upload_params(image_path, device_uid))
-        return 0;
-
-    // Verify the shutdown image file exists before attempting upload
-    if (access(image_path, F_OK) != 0)
-    {
-        log_message(LOG_WARNING,
-                    "Shutdown image not found, skipping registration: %s",
-                    image_path);
-        return 0;
-    }
-
-    char url[CC_URL_SIZE];
-    int written = snprintf(url, sizeof(url),
-                           "%s/devices/%s/settings/lcd/lcd/shutdown-image",
-                           config->daemon_address, device_uid);
-    if (!validate_snprintf(written, sizeof(url), url))
-    {
-        log_message(LOG_ERROR, "Shutdown image URL truncated");
-        return 0;
-    }
-
-    curl_mime *mime = curl_mime_init(cc_session.curl_handle);
+    curl_mime *mime = curl_mime_init(curl);
     if (!mime)
-    {
-        log_message(LOG_ERROR, "Failed to init multipart form for shutdown image");
-        return 0;
-    }
+        return NULL;
 
     // mode field
     curl_mimepart *part = curl_mime_addpart(mime);
@@ -471,34 +1279,255 @@ int register_lcd_shutdown_image_with_cc(const Config *config,
         curl_mime_data(part, orientation_str, CURL_ZERO_TERMINATED);
     }
 
-    // image file field — CC uses "images[]" as the multipart field name
-    part = curl_mime_addpart(mime);
+    return mime;
+}
+
+/**
+ * @brief Uploads an in-memory PNG or animated GIF to the LCD via multipart PUT.
+ * @details Sends the encoded frame to /devices/{uid}/settings/lcd/lcd/images,
+ * so no image file is written or re-read. Sets unsupported to 1 if the
+ * endpoint is not available (HTTP 404/405) or, for an animation, if
+ * CoolerControl refuses the image (HTTP 400/415/422).
+ */
+int send_image_data_to_lcd(const Config *config,
+                           const unsigned char *image_data, size_t image_size,
+                           int animated, const char *device_uid,
+                           int *unsupported)
+{
+    if (unsupported)
+        *unsupported = 0;
+
+    if (!cc_session.curl_handle || !cc_session.session_initialized ||
+        !image_data || image_size == 0 || !device_uid)
+    {
+        log_message(LOG_ERROR, "Invalid parameters or session not initialized");
+        return 0;
+    }
+
+    LcdEndpointUrls *urls = get_lcd_urls(config, device_uid);
+    if (!urls)
+    {
+        log_message(LOG_ERROR, "LCD image URL truncated");
+        return 0;
+    }
+
+    curl_mime *mime = build_lcd_image_mime(cc_session.curl_handle, config);
+    if (!mime)
+    {
+        log_message(LOG_ERROR, "Failed to init multipart form for LCD image");
+        return 0;
+    }
+
+    // image data field — sent from memory, named like a file upload
+    curl_mimepart *part = curl_mime_addpart(mime);
     curl_mime_name(part, "images[]");
-    curl_mime_filedata(part, image_path);
-    curl_mime_type(part, "image/png");
+    curl_mime_data(part, (const char *)image_data, image_size);
+    curl_mime_filename(part, animated ? "coolerdash.gif" : "coolerdash.png");
+    curl_mime_type(part, animated ? "image/gif" : "image/png");
 
-    http_response response = {0};
-    if (!cc_init_response_buffer(&response, 4096))
+    http_response *response = &cc_session.upload_response;
+    if (!cc_reuse_response_buffer(response, 4096))
     {
         curl_mime_free(mime);
         return 0;
     }
 
-    struct curl_slist *headers = NULL;
-    headers = curl_slist_append(headers, cc_session.access_token);
-
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_URL, url);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_URL, urls->images_url);
     curl_easy_setopt(cc_session.curl_handle, CURLOPT_CUSTOMREQUEST, "PUT");
     curl_easy_setopt(cc_session.curl_handle, CURLOPT_MIMEPOST, mime);
     curl_easy_setopt(
         cc_session.curl_handle, CURLOPT_WRITEFUNCTION,
         (size_t (*)(const void *, size_t, size_t, void *))write_callback);
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_HTTPHEADER,
+                     cc_session.headers[CC_HEADERS_DEFAULT]);
+
+    CURLcode res = cc_perform_transfer(cc_session.curl_handle,
+                                       cc_request_deadline_ms(config));
+    cc_record_transfer(cc_session.curl_handle);
+    long http_code = -1;
+    curl_easy_getinfo(cc_session.curl_handle, CURLINFO_RESPONSE_CODE, &http_code);
+
+    int success = 0;
+    const int rejected = animated && (http_code == 400 || http_code == 415 ||
+                                      http_code == 422);
+    if (res == CURLE_OK && (http_code == 404 || http_code == 405 || rejected))
+    {
+        if (unsupported)
+            *unsupported = 1;
+    }
+    else
+    {
+        success = check_upload_response(res, http_code, response);
+    }
+
+    // Cleanup: MIMEPOST must be cleared explicitly before reset_curl_request_options
+    curl_mime_free(mime);
+    curl_easy_setopt(cc_session.curl_handle, CURLOPT_MIMEPOST, NULL);
+    reset_curl_request_options();
+
+    return success;
+}
+
+/** @brief Write callback that drops the response body. */
+static size_t discard_callback(const void *contents, size_t size, size_t nmemb,
+                               void *userp)
+{
+    (void)contents;
+    (void)userp;
+    return size * nmemb;
+}
+
+/**
+ * @brief Send one GET /handshake on the probe handle.
+ * @details The handle is created on first use and kept for the session, so a
+ * probe after recovery reuses the pooled connection.
+ * @return 1 if coolercontrold answered below HTTP 500, 0 otherwise
+ */
+static int probe_daemon(const Config *config)
+{
+    const char *url = get_session_url(CC_ENDPOINT_HANDSHAKE);
+    if (url[0] == '\0')
+        return 0;
+
+    if (!cc_session.probe_handle)
+    {
+        cc_session.probe_handle = cc_create_easy_handle();
+        if (!cc_session.probe_handle)
+            return 0;
+    }
+
+    CURL *curl = cc_session.probe_handle;
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER,
+                     cc_session.headers[CC_HEADERS_DEFAULT]);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, discard_callback);
+
+    const CURLcode res = cc_perform_transfer(curl, cc_request_deadline_ms(config));
+    cc_record_transfer(curl);
 
-    CURLcode res = curl_easy_perform(cc_session.curl_handle);
     long http_code = 0;
-    curl_easy_getinfo(cc_session.curl_handle, CURLINFO_RESPONSE_CODE, &http_code);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    log_message(LOG_INFO, "Health probe: CURL %d, HTTP %ld", (int)res, http_code);
+    return res == CURLE_OK && http_code > 0 && http_code < 500;
+}
+
+/**
+ * @brief Check the circuit breaker, probing coolercontrold when it is due.
+ */
+cc_circuit_state cc_check_circuit(const Config *config)
+{
+    pthread_mutex_lock(&breaker.lock);
+    const int due = breaker.open && stats_clock_ns() >= breaker.retry_at_ns;
+    const int open = breaker.open;
+    pthread_mutex_unlock(&breaker.lock);
+
+    if (!open)
+        return CC_CIRCUIT_CLOSED;
+    if (!due)
+        return CC_CIRCUIT_OPEN;
+
+    const int reachable = probe_daemon(config);
+    const uint64_t now_ns = stats_clock_ns();
+
+    pthread_mutex_lock(&breaker.lock);
+    long delay_ms = 0;
+    const double outage_s = (double)(now_ns - breaker.opened_at_ns) / 1e9;
+    if (reachable)
+    {
+        breaker.open = 0;
+        breaker.failures = 0;
+    }
+    else
+    {
+        breaker.backoff_ms = breaker.backoff_ms * 2 < CC_BREAKER_MAX_BACKOFF_MS
+                                 ? breaker.backoff_ms * 2
+                                 : CC_BREAKER_MAX_BACKOFF_MS;
+        delay_ms = schedule_probe(now_ns);
+    }
+    pthread_mutex_unlock(&breaker.lock);
+
+    if (!reachable)
+    {
+        log_message(LOG_INFO, "CoolerControl still unreachable, next probe in %.1fs",
+                    (double)delay_ms / 1000.0);
+        return CC_CIRCUIT_OPEN;
+    }
+
+    log_message(LOG_STATUS, "CoolerControl reachable again after %.0fs, resuming updates",
+                outage_s);
+    return CC_CIRCUIT_RECOVERED;
+}
+
+/**
+ * @brief Register shutdown image with CoolerControl's native LCD shutdown image API.
+ * @details Uploads the shutdown PNG to CC at daemon startup via multipart PUT to
+ *          /devices/{uid}/settings/lcd/lcd/shutdown-image.
+ *          CC stores the image internally and applies it automatically when the
+ *          CC daemon shuts down. Handles 404 gracefully (CC version too old).
+ *          Uses its own pooled handle and no session caches, so it can run in
+ *          the background while the pipeline uploads frames.
+ */
+int register_lcd_shutdown_image_with_cc(const Config *config,
+                                        const char *image_path,
+                                        const char *device_uid)
+{
+    if (!config || !validate_upload_params(image_path, device_uid))
+        return 0;
+
+    // Verify the shutdown image file exists before attempting upload
+    if (access(image_path, F_OK) != 0)
+    {
+        log_message(LOG_WARNING,
+                    "Shutdown image not found, skipping registration: %s",
+                    image_path);
+        return 0;
+    }
+
+    char shutdown_url[CC_URL_SIZE];
+    if (!validate_snprintf(
+            snprintf(shutdown_url, sizeof(shutdown_url),
+                     "%s/devices/%s/settings/lcd/lcd/shutdown-image",
+                     config->daemon_address, device_uid),
+            sizeof(shutdown_url), shutdown_url))
+    {
+        log_message(LOG_ERROR, "Shutdown image URL truncated");
+        return 0;
+    }
+
+    CURL *curl = cc_create_easy_handle();
+    if (!curl)
+        return 0;
+
+    curl_mime *mime = build_lcd_image_mime(curl, config);
+    if (!mime)
+    {
+        log_message(LOG_ERROR, "Failed to init multipart form for shutdown image");
+        cc_release_easy_handle(curl);
+        return 0;
+    }
+
+    // image file field — CC uses "images[]" as the multipart field name
+    curl_mimepart *part = curl_mime_addpart(mime);
+    curl_mime_name(part, "images[]");
+    curl_mime_filedata(part, image_path);
+    curl_mime_type(part, "image/png");
+
+    curl_easy_setopt(curl, CURLOPT_URL, shutdown_url);
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
+    curl_easy_setopt(curl, CURLOPT_MIMEPOST, mime);
+    curl_easy_setopt(
+        curl, CURLOPT_WRITEFUNCTION,
+        (size_t (*)(const void *, size_t, size_t, void *))discard_callback);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER,
+                     cc_session.headers[CC_HEADERS_DEFAULT]);
+
+    // One-off file upload at startup, not bound to the refresh interval
+    CURLcode res = cc_perform_transfer(curl, CC_MAX_DEADLINE_MS);
+    cc_record_transfer(curl);
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
 
     int success = 0;
     if (res == CURLE_OK && (http_code == 200 || http_code == 204))
@@ -514,20 +1543,14 @@ int register_lcd_shutdown_image_with_cc(const Config *config,
                     "CC shutdown image API not available (requires CC >= 4.3)");
         success = 1;
     }
-    else
+    else if (res != CURLE_ABORTED_BY_CALLBACK)
     {
         log_message(LOG_WARNING,
                     "Shutdown image registration failed: CURL %d, HTTP %ld",
                     (int)res, http_code);
     }
 
-    // Cleanup: MIMEPOST must be cleared explicitly before reset_curl_request_options
-    cc_cleanup_response_buffer(&response);
-    if (headers)
-        curl_slist_free_all(headers);
+    cc_release_easy_handle(curl);
     curl_mime_free(mime);
-    curl_easy_setopt(cc_session.curl_handle, CURLOPT_MIMEPOST, NULL);
-    reset_curl_request_options();
-
     return success;
 }
@@ -16,6 +16,8 @@
 
 // Include necessary headers
 // cppcheck-suppress-begin missingIncludeSystem
+#include <curl/curl.h>
+#include <pthread.h>
 #include <stddef.h>
 #include <stdint.h>
 // cppcheck-suppress-end missingIncludeSystem
@@ -28,6 +30,15 @@
 #define CC_URL_SIZE 512
 #define CC_BEARER_HEADER_SIZE (CONFIG_MAX_TOKEN_LEN + 32)
 
+// Bounds of per-request deadlines derived from display_refresh_interval
+#define CC_MIN_DEADLINE_MS 1000L
+#define CC_MAX_DEADLINE_MS 10000L
+
+// Circuit breaker: consecutive failed requests that open it, probe backoff bounds
+#define CC_BREAKER_FAILURE_THRESHOLD 3
+#define CC_BREAKER_MIN_BACKOFF_MS 1000L
+#define CC_BREAKER_MAX_BACKOFF_MS 60000L
+
 // Maximum safe allocation size to prevent overflow
 #define CC_MAX_SAFE_ALLOC_SIZE (SIZE_MAX / 2)
 
@@ -35,6 +46,41 @@
 struct Config;
 struct curl_slist;
 
+/** @brief Fixed CoolerControl API endpoints, resolved once per session. */
+typedef enum
+{
+    CC_ENDPOINT_STATUS,
+    CC_ENDPOINT_DEVICES,
+    CC_ENDPOINT_SSE_STATUS,
+    CC_ENDPOINT_HANDSHAKE,
+    CC_ENDPOINT_COUNT
+} cc_endpoint;
+
+/** @brief Prebuilt request header lists, owned by the session. */
+typedef enum
+{
+    CC_HEADERS_DEFAULT, // Accept, User-Agent, Authorization
+    CC_HEADERS_JSON,    // CC_HEADERS_DEFAULT plus Content-Type: application/json
+    CC_HEADERS_EVENT_STREAM, // Accept: text/event-stream, User-Agent, Authorization
+    CC_HEADERS_COUNT
+} cc_header_set;
+
+/** @brief Circuit breaker state seen by the fetch stage. */
+typedef enum
+{
+    CC_CIRCUIT_CLOSED,    // Requests run normally
+    CC_CIRCUIT_OPEN,      // coolercontrold unreachable, requests fail at once
+    CC_CIRCUIT_RECOVERED  // The health probe just closed the breaker
+} cc_circuit_state;
+
+/** @brief Connection reuse counters of all CoolerControl requests. */
+typedef struct
+{
+    unsigned long requests;    // Completed transfers
+    unsigned long reused;      // Transfers that needed no new connection
+    unsigned long connections; // Connections opened in total
+} cc_connection_stats;
+
 /** @brief Dynamic buffer for libcurl HTTP response data. */
 typedef struct http_response
 {
@@ -49,6 +95,24 @@ int cc_init_response_buffer(http_response *response, size_t initial_capacity);
 /** @brief Free HTTP response buffer. */
 void cc_cleanup_response_buffer(http_response *response);
 
+/**
+ * @brief Empty a long-lived response buffer, allocating it on first use.
+ * @details Keeps the high-water capacity of earlier responses, so steady-state
+ * requests do not allocate.
+ */
+int cc_reuse_response_buffer(http_response *response, size_t initial_capacity);
+
+/**
+ * @brief Count a heap allocation of a frame-loop buffer.
+ * @details Called wherever response buffers, encoder buffers, cairo surfaces
+ * and request bodies of the fetch/render/upload loop are allocated or grown.
+ * Allocations inside libcurl, jansson and cairo are not included.
+ */
+void cc_count_allocation(void);
+
+/** @brief Number of frame-loop buffer allocations so far (thread-safe). */
+unsigned long get_allocation_count(void);
+
 /** @brief libcurl write callback — appends received data to response buffer. */
 size_t write_callback(const void *contents, size_t size, size_t nmemb,
                       http_response *response);
@@ -68,10 +132,101 @@ void reset_coolercontrol_session(void);
 /** @brief Returns active Bearer token (empty if not set). */
 const char *get_session_access_token(void);
 
+/**
+ * @brief Create a CURL easy handle attached to the shared connection pool.
+ * @details Connections, DNS and TLS sessions are shared between all handles of
+ * the session and kept alive between requests. Free the handle with
+ * cc_release_easy_handle() before the session is reset or cleaned up.
+ * @return New handle, or NULL on failure
+ */
+CURL *cc_create_easy_handle(void);
+
+/** @brief Free a handle from cc_create_easy_handle() and its transfer engine. */
+void cc_release_easy_handle(CURL *curl);
+
+/**
+ * @brief Run a transfer on the handle's curl_multi engine with a deadline.
+ * @details Waits in curl_multi_poll() so cc_abort_transfers() can interrupt
+ * it from another thread. Connect and total time are bound by timeout_ms;
+ * timeout_ms <= 0 only bounds the connect (long-lived streams). The result
+ * feeds the circuit breaker (see cc_check_circuit()).
+ * @return CURLE_OK on success, CURLE_OPERATION_TIMEDOUT past the deadline,
+ * CURLE_ABORTED_BY_CALLBACK if aborted, CURLE_COULDNT_CONNECT while the
+ * breaker is open
+ */
+CURLcode cc_perform_transfer(CURL *curl, long timeout_ms);
+
+/**
+ * @brief Run a transfer to a host other than coolercontrold.
+ * @details Like cc_perform_transfer(), but outside the circuit breaker: it is
+ * neither blocked by an open breaker nor counted towards it.
+ */
+CURLcode cc_perform_external_transfer(CURL *curl, long timeout_ms);
+
+/**
+ * @brief Check the circuit breaker, probing coolercontrold when it is due.
+ * @details After CC_BREAKER_FAILURE_THRESHOLD consecutive failed requests
+ * (connection errors, timeouts, HTTP 5xx from /status, /devices or /handshake)
+ * the breaker opens: every cc_perform_transfer() fails with
+ * CURLE_COULDNT_CONNECT without touching the network. Once the backoff (exponential with jitter, CC_BREAKER_MIN_BACKOFF_MS
+ * .. CC_BREAKER_MAX_BACKOFF_MS) has passed, this call sends one GET /handshake;
+ * success closes the breaker, failure doubles the backoff. Called from the
+ * fetch stage only.
+ * @return CC_CIRCUIT_RECOVERED once after the probe closed the breaker,
+ * CC_CIRCUIT_OPEN while it stays open, CC_CIRCUIT_CLOSED otherwise
+ */
+cc_circuit_state cc_check_circuit(const struct Config *config);
+
+/** @brief Abort running transfers and fail new ones until the next session. */
+void cc_abort_transfers(void);
+
+/**
+ * @brief Abort the transfers of one thread and fail its new ones.
+ * @details Lets a reload stop a background thread's requests without touching
+ * the session or the parked pipeline. Lifted by cc_clear_thread_abort() after
+ * the thread was joined, since a thread ID can be reused.
+ */
+void cc_abort_thread_transfers(pthread_t thread);
+
+/** @brief Lift cc_abort_thread_transfers() once the thread was joined. */
+void cc_clear_thread_abort(void);
+
+/**
+ * @brief Deadline of one sensor fetch or LCD upload.
+ * @details One refresh interval, clamped to CC_MIN_DEADLINE_MS..
+ * CC_MAX_DEADLINE_MS, so a slow endpoint skips frames instead of stalling.
+ */
+long cc_request_deadline_ms(const struct Config *config);
+
+/** @brief Returns the cached URL of an endpoint (empty if no session). */
+const char *get_session_url(cc_endpoint endpoint);
+
+/**
+ * @brief Returns a prebuilt header list for CURLOPT_HTTPHEADER.
+ * @details The list stays valid until the session is reset; do not free it.
+ */
+struct curl_slist *get_session_headers(cc_header_set set);
+
+/** @brief Account a finished transfer in the connection reuse counters. */
+void cc_record_transfer(CURL *curl);
+
+/** @brief Copy the connection reuse counters (thread-safe). */
+void get_connection_stats(cc_connection_stats *stats);
+
 /** @brief Upload image to LCD via JSON (CC4) or multipart (CC3). */
 int send_image_to_lcd(const struct Config *config, const char *image_path,
                       const char *device_uid);
 
+/**
+ * @brief Upload an in-memory PNG or animated GIF to LCD via multipart.
+ * @details Flags a missing endpoint, and for animations also a rejected
+ * image (HTTP 400/415/422), in unsupported.
+ */
+int send_image_data_to_lcd(const struct Config *config,
+                           const unsigned char *image_data, size_t image_size,
+                           int animated, const char *device_uid,
+                           int *unsupported);
+
 /** @brief Register shutdown image with CC's native LCD shutdown image API (startup). */
 int register_lcd_shutdown_image_with_cc(const struct Config *config,
                                         const char *image_path,
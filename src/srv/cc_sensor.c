@@ -9,13 +9,18 @@
 
 /**
  * @brief Sensor monitoring via CoolerControl /status endpoint.
+ * @details Polls POST /status, or subscribes to the /sse/status stream.
  */
 
+// Define POSIX constants
+#define _POSIX_C_SOURCE 200112L
+
 // Include necessary headers
 // cppcheck-suppress-begin missingIncludeSystem
 #include <ctype.h>
 #include <curl/curl.h>
 #include <jansson.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -23,6 +28,7 @@
 
 // Include project headers
 #include "../device/config.h"
+#include "../device/stats.h"
 #include "cc_conf.h"
 #include "cc_main.h"
 #include "cc_sensor.h"
@@ -30,6 +36,65 @@
 /** @brief Cached CURL handle for sensor polling. */
 static CURL *sensor_curl_handle = NULL;
 
+/** @brief /status response buffer, kept at its high-water capacity. */
+static struct http_response sensor_response = {0};
+
+// Consecutive polls without any new status before a full resync
+#define STATUS_RESYNC_EMPTY_POLLS 5
+
+// A status stream without any byte for this long is considered dead
+#define STATUS_STREAM_STALL_SEC 15L
+
+// Snapshot value of a slot sensor that does not resolve
+#define SLOT_VALUE_MISSING -1.0e30f
+
+// Device types reachable through legacy slot values
+#define SLOT_DEVICE_CPU 0x1u
+#define SLOT_DEVICE_GPU 0x2u
+#define SLOT_DEVICE_LIQUID 0x4u
+
+/** @brief Device UID and sensor name of a dynamic ("uid:name") slot. */
+typedef struct
+{
+    char uid[SENSOR_UID_LEN];
+    char name[SENSOR_NAME_LEN];
+} slot_sensor_ref_t;
+
+/**
+ * @brief Sensors the configured slots can resolve to.
+ * @details Legacy slots match by device type, dynamic slots by UID. Devices
+ * matching neither are skipped while parsing /status.
+ */
+typedef struct
+{
+    int valid;
+    unsigned int legacy_devices;
+    int ref_count;
+    slot_sensor_ref_t refs[3 * MAX_LCD_DISPLAYS];
+} slot_sensor_filter_t;
+
+/**
+ * @brief Persistent sensor state for incremental /status polling.
+ * @details The cursor holds the newest status timestamp received and is sent
+ * as "since", so coolercontrold only returns newer statuses. Devices without
+ * a new status keep their previous values. names holds the name of each
+ * entry, written when the entry is created and unchanged until the reset.
+ */
+static struct
+{
+    monitor_sensor_data_t data;
+    char names[MAX_SENSORS][SENSOR_NAME_LEN];
+    char cursor[64];
+    char post_body[128];
+    int empty_polls;
+    int unknown_devices;
+    slot_sensor_filter_t filter;
+} sensor_state = {0};
+
+/* Forward declaration — defined below, used here before its definition */
+static void resolve_slot_indices(const Config *configs, int config_count,
+                                 monitor_sensor_data_t *data);
+
 static int contains_ci(const char *haystack, const char *needle)
 {
     if (!haystack || !needle || needle[0] == '\0')
@@ -65,47 +130,97 @@ static int is_load_duty_name(const char *name)
            contains_ci(name, "gpu") || contains_ci(name, "cpu");
 }
 
-/** @brief Init or return cached CURL handle. */
+/**
+ * @brief Init or return cached CURL handle.
+ * @details The handle joins the session's shared connection pool and keeps
+ * the /status URL, method and prebuilt headers across ticks, so only the
+ * response buffer and request body change per request.
+ */
 static CURL *get_sensor_curl_handle(void)
 {
+    if (sensor_curl_handle)
+        return sensor_curl_handle;
+
+    const char *url = get_session_url(CC_ENDPOINT_STATUS);
+    struct curl_slist *headers = get_session_headers(CC_HEADERS_JSON);
+    if (url[0] == '\0' || !headers)
+    {
+        log_message(LOG_ERROR, "Sensor request without CoolerControl session");
+        return NULL;
+    }
+
+    sensor_curl_handle = cc_create_easy_handle();
     if (!sensor_curl_handle)
     {
-        sensor_curl_handle = curl_easy_init();
-        if (!sensor_curl_handle)
-            log_message(LOG_ERROR, "Failed to initialize sensor CURL handle");
+        log_message(LOG_ERROR, "Failed to initialize sensor CURL handle");
+        return NULL;
     }
+
+    curl_easy_setopt(sensor_curl_handle, CURLOPT_URL, url);
+    curl_easy_setopt(sensor_curl_handle, CURLOPT_WRITEFUNCTION,
+                     (curl_write_callback)write_callback);
+    curl_easy_setopt(sensor_curl_handle, CURLOPT_POST, 1L);
+    curl_easy_setopt(sensor_curl_handle, CURLOPT_HTTPHEADER, headers);
     return sensor_curl_handle;
 }
 
-/** @brief Free cached sensor CURL handle at daemon shutdown. */
+/** @brief Drop cached sensor values and restart polling from the epoch. */
+void reset_sensor_state(void)
+{
+    memset(&sensor_state, 0, sizeof(sensor_state));
+}
+
+/** @brief Restart incremental polling from the epoch, keeping cached values. */
+void restart_status_polling(void)
+{
+    sensor_state.cursor[0] = '\0';
+    sensor_state.empty_polls = 0;
+}
+
+/** @brief Free cached sensor CURL handle and response buffer before the session is reset. */
 void cleanup_sensor_curl_handle(void)
 {
     if (sensor_curl_handle)
     {
-        curl_easy_cleanup(sensor_curl_handle);
+        cc_release_easy_handle(sensor_curl_handle);
         sensor_curl_handle = NULL;
     }
+    cc_cleanup_response_buffer(&sensor_response);
 }
 
-/** @brief Append a sensor entry with bounds check. Returns 1 on success. */
-static int add_sensor_entry(monitor_sensor_data_t *data,
-                            const char *name, const char *device_uid,
-                            const char *device_type, sensor_category_t category,
-                            float value, const char *unit, int use_decimal)
+/**
+ * @brief Update a sensor entry in place, or append it if new.
+ * @details Entries are matched by device id, category and name; a match only
+ * takes the new value and the device's current record. Returns 1 on success,
+ * 0 if the sensor is new and the table is full.
+ */
+static int add_sensor_entry(monitor_sensor_data_t *data, const char *name,
+                            const sensor_device_t *device,
+                            sensor_category_t category, float value,
+                            const char *unit, int use_decimal)
 {
+    for (int i = 0; i < data->sensor_count; i++)
+    {
+        sensor_entry_t *entry = &data->sensors[i];
+        if (entry->device->id == device->id && entry->category == category &&
+            strcmp(entry->name, name) == 0)
+        {
+            entry->device = device;
+            entry->value = value;
+            return 1;
+        }
+    }
+
     if (data->sensor_count >= MAX_SENSORS)
         return 0;
 
-    sensor_entry_t *entry = &data->sensors[data->sensor_count];
-    cc_safe_strcpy(entry->name, sizeof(entry->name), name);
-    cc_safe_strcpy(entry->device_uid, sizeof(entry->device_uid), device_uid);
-    cc_safe_strcpy(entry->device_type, sizeof(entry->device_type), device_type);
-    cc_safe_strcpy(entry->unit, sizeof(entry->unit), unit);
-
-    /* Device name from cache */
-    const char *dev_name = get_device_name_by_uid(device_uid);
-    cc_safe_strcpy(entry->device_name, sizeof(entry->device_name), dev_name);
+    char *entry_name = sensor_state.names[data->sensor_count];
+    cc_safe_strcpy(entry_name, SENSOR_NAME_LEN, name);
 
+    sensor_entry_t *entry = &data->sensors[data->sensor_count];
+    entry->name = entry_name;
+    entry->device = device;
+    entry->unit = unit;
     entry->category = category;
     entry->value = value;
     entry->use_decimal = use_decimal;
@@ -114,23 +229,173 @@ static int add_sensor_entry(monitor_sensor_data_t *data,
     return 1;
 }
 
-/** @brief Collect temperature sensors from latest device status_history entry. */
-static void collect_device_temps(const json_t *device, const char *device_uid,
-                                 const char *device_type,
-                                 monitor_sensor_data_t *data)
+/** @brief Copy the header, slot table and valid entries of sensor data. */
+void copy_sensor_data(monitor_sensor_data_t *dest,
+                      const monitor_sensor_data_t *src)
+{
+    if (!dest || !src || dest == src)
+        return;
+    memcpy(dest, src,
+           offsetof(monitor_sensor_data_t, sensors) +
+               (size_t)src->sensor_count * sizeof(src->sensors[0]));
+}
+
+/**
+ * @brief Get the newest status entry of a device.
+ * @return Last status_history entry, or NULL if no new status was returned
+ */
+static const json_t *get_latest_status(const json_t *device)
 {
     const json_t *status_history = json_object_get(device, "status_history");
     if (!status_history || !json_is_array(status_history))
-        return;
+        return NULL;
 
     size_t history_count = json_array_size(status_history);
     if (history_count == 0)
+        return NULL;
+
+    return json_array_get(status_history, history_count - 1);
+}
+
+/**
+ * @brief Track the oldest latest-status timestamp of this poll.
+ * @details Timestamps share one RFC 3339 format, so a string comparison
+ * orders them. Using the oldest device timestamp as cursor never skips a
+ * status of a slower device. Values with characters that would need JSON
+ * escaping are ignored.
+ */
+static void track_status_timestamp(const json_t *status, char *poll_cursor,
+                                   size_t cursor_size)
+{
+    const json_t *ts_val = json_object_get(status, "timestamp");
+    if (!ts_val || !json_is_string(ts_val))
+        return;
+
+    const char *timestamp = json_string_value(ts_val);
+    const size_t len = strlen(timestamp);
+    if (len == 0 || len >= cursor_size ||
+        strspn(timestamp, "0123456789-+:.TZ") != len)
+        return;
+
+    if (poll_cursor[0] == '\0' || strcmp(timestamp, poll_cursor) < 0)
+        cc_safe_strcpy(poll_cursor, cursor_size, timestamp);
+}
+
+// ============================================================================
+// Slot Sensor Filter
+// ============================================================================
+
+/** @brief Map a device type string to its legacy slot bit (0 if none). */
+static unsigned int get_slot_device_bit(const char *device_type)
+{
+    if (strcmp(device_type, "CPU") == 0)
+        return SLOT_DEVICE_CPU;
+    if (strcmp(device_type, "GPU") == 0)
+        return SLOT_DEVICE_GPU;
+    if (strcmp(device_type, "Liquidctl") == 0)
+        return SLOT_DEVICE_LIQUID;
+    return 0;
+}
+
+/** @brief Add one slot value to the sensor filter. */
+static void add_slot_to_filter(slot_sensor_filter_t *filter,
+                               const char *slot_value)
+{
+    if (!slot_value || slot_value[0] == '\0' ||
+        strcmp(slot_value, "none") == 0)
+        return;
+
+    /* The cpu slot also shows the AIO fan RPM in circle mode */
+    if (strcmp(slot_value, "cpu") == 0)
+    {
+        filter->legacy_devices |= SLOT_DEVICE_CPU | SLOT_DEVICE_LIQUID;
+        return;
+    }
+    if (strcmp(slot_value, "gpu") == 0)
+    {
+        filter->legacy_devices |= SLOT_DEVICE_GPU;
+        return;
+    }
+    if (strcmp(slot_value, "liquid") == 0)
+    {
+        filter->legacy_devices |= SLOT_DEVICE_LIQUID;
         return;
+    }
 
-    const json_t *last_status = json_array_get(status_history, history_count - 1);
-    if (!last_status)
+    const char *separator = strchr(slot_value, ':');
+    if (!separator || separator == slot_value)
         return;
 
+    const size_t uid_len = (size_t)(separator - slot_value);
+    const int max_refs = (int)(sizeof(filter->refs) / sizeof(filter->refs[0]));
+    if (uid_len >= SENSOR_UID_LEN || filter->ref_count >= max_refs)
+        return;
+
+    slot_sensor_ref_t *ref = &filter->refs[filter->ref_count++];
+    memcpy(ref->uid, slot_value, uid_len);
+    ref->uid[uid_len] = '\0';
+    cc_safe_strcpy(ref->name, sizeof(ref->name), separator + 1);
+}
+
+/** @brief Build the sensor filter from the slots of all display configs. */
+static void build_slot_filter(const Config *configs, int config_count,
+                              slot_sensor_filter_t *filter)
+{
+    memset(filter, 0, sizeof(*filter));
+    for (int i = 0; i < config_count; i++)
+    {
+        add_slot_to_filter(filter, configs[i].sensor_slot_1);
+        add_slot_to_filter(filter, configs[i].sensor_slot_2);
+        add_slot_to_filter(filter, configs[i].sensor_slot_3);
+    }
+    filter->valid = 1;
+}
+
+/**
+ * @brief Check if any slot can resolve to a sensor of this device.
+ * @details All channels of a matching device are kept, since circle mode
+ * shows frequency, watts, RPM and duty next to the slot value.
+ */
+static int filter_wants_device(const slot_sensor_filter_t *filter,
+                               const char *device_uid,
+                               const char *device_type)
+{
+    if (filter->legacy_devices & get_slot_device_bit(device_type))
+        return 1;
+
+    for (int i = 0; i < filter->ref_count; i++)
+    {
+        if (strcmp(filter->refs[i].uid, device_uid) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+/** @brief Check if any slot can resolve to this temperature sensor. */
+static int filter_wants_temp(const slot_sensor_filter_t *filter,
+                             const char *device_uid, const char *device_type,
+                             const char *name)
+{
+    if (filter->legacy_devices & get_slot_device_bit(device_type))
+        return 1;
+
+    for (int i = 0; i < filter->ref_count; i++)
+    {
+        if (strcmp(filter->refs[i].uid, device_uid) == 0 &&
+            strcmp(filter->refs[i].name, name) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+/** @brief Collect temperature sensors from latest device status_history entry. */
+static void collect_device_temps(const json_t *last_status,
+                                 const sensor_device_t *device,
+                                 const slot_sensor_filter_t *filter,
+                                 monitor_sensor_data_t *data)
+{
     const json_t *temps = json_object_get(last_status, "temps");
     if (!temps || !json_is_array(temps))
         return;
@@ -149,6 +414,10 @@ static void collect_device_temps(const json_t *device, const char *device_uid,
             !temp_val || !json_is_number(temp_val))
             continue;
 
+        if (!filter_wants_temp(filter, device->uid, device->type,
+                               json_string_value(name_val)))
+            continue;
+
         float temperature = (float)json_number_value(temp_val);
 
         /* Skip invalid readings */
@@ -156,10 +425,10 @@ static void collect_device_temps(const json_t *device, const char *device_uid,
             continue;
 
         /* Decimal only for Liquidctl (coolant) sensors */
-        int use_dec = (strcmp(device_type, "Liquidctl") == 0) ? 1 : 0;
+        int use_dec = (strcmp(device->type, "Liquidctl") == 0) ? 1 : 0;
 
-        add_sensor_entry(data, json_string_value(name_val), device_uid,
-                         device_type, SENSOR_CATEGORY_TEMP, temperature,
+        add_sensor_entry(data, json_string_value(name_val), device,
+                         SENSOR_CATEGORY_TEMP, temperature,
                          "\xC2\xB0"
                          "C",
                          use_dec);
@@ -171,23 +440,10 @@ static void collect_device_temps(const json_t *device, const char *device_uid,
  * @details Iterates channels[] array and creates entries for RPM, duty,
  * watts, and freq values.
  */
-static void collect_device_channels(const json_t *device,
-                                    const char *device_uid,
-                                    const char *device_type,
+static void collect_device_channels(const json_t *last_status,
+                                    const sensor_device_t *device,
                                     monitor_sensor_data_t *data)
 {
-    const json_t *status_history = json_object_get(device, "status_history");
-    if (!status_history || !json_is_array(status_history))
-        return;
-
-    size_t history_count = json_array_size(status_history);
-    if (history_count == 0)
-        return;
-
-    const json_t *last_status = json_array_get(status_history, history_count - 1);
-    if (!last_status)
-        return;
-
     const json_t *channels = json_object_get(last_status, "channels");
     if (!channels || !json_is_array(channels))
         return;
@@ -216,8 +472,8 @@ static void collect_device_channels(const json_t *device,
                 int n = snprintf(sensor_name, sizeof(sensor_name),
                                  "%s RPM", ch_name);
                 if (n > 0 && (size_t)n < sizeof(sensor_name))
-                    add_sensor_entry(data, sensor_name, device_uid,
-                                     device_type, SENSOR_CATEGORY_RPM,
+                    add_sensor_entry(data, sensor_name, device,
+                                     SENSOR_CATEGORY_RPM,
                                      rpm, "RPM", 0);
             }
         }
@@ -230,8 +486,8 @@ static void collect_device_channels(const json_t *device,
             int n = snprintf(sensor_name, sizeof(sensor_name),
                              "%s Duty", ch_name);
             if (n > 0 && (size_t)n < sizeof(sensor_name))
-                add_sensor_entry(data, sensor_name, device_uid,
-                                 device_type, SENSOR_CATEGORY_DUTY,
+                add_sensor_entry(data, sensor_name, device,
+                                 SENSOR_CATEGORY_DUTY,
                                  duty, "%", 1);
         }
 
@@ -243,8 +499,8 @@ static void collect_device_channels(const json_t *device,
             int n = snprintf(sensor_name, sizeof(sensor_name),
                              "%s Watts", ch_name);
             if (n > 0 && (size_t)n < sizeof(sensor_name))
-                add_sensor_entry(data, sensor_name, device_uid,
-                                 device_type, SENSOR_CATEGORY_WATTS,
+                add_sensor_entry(data, sensor_name, device,
+                                 SENSOR_CATEGORY_WATTS,
                                  watts, "W", 1);
         }
 
@@ -256,30 +512,32 @@ static void collect_device_channels(const json_t *device,
             int n = snprintf(sensor_name, sizeof(sensor_name),
                              "%s Freq", ch_name);
             if (n > 0 && (size_t)n < sizeof(sensor_name))
-                add_sensor_entry(data, sensor_name, device_uid,
-                                 device_type, SENSOR_CATEGORY_FREQ,
+                add_sensor_entry(data, sensor_name, device,
+                                 SENSOR_CATEGORY_FREQ,
                                  freq, "MHz", 0);
         }
     }
 }
 
 /**
- * @brief Parse /status JSON and collect all sensors from all devices.
- * @details Iterates all devices and collects temperature and channel data
- * into the monitor_sensor_data_t structure.
+ * @brief Parse /status JSON and update sensors of the configured slots.
+ * @details Iterates all devices that returned a new status and updates their
+ * temperature and channel entries in the persistent sensor table. Devices and
+ * temperatures no slot can resolve to are skipped.
  */
-static int parse_all_sensor_data(const char *json, monitor_sensor_data_t *data)
+static int parse_all_sensor_data(const char *json, size_t json_size,
+                                 const slot_sensor_filter_t *filter,
+                                 monitor_sensor_data_t *data)
 {
-    if (!json || json[0] == '\0' || !data)
+    if (!json || json_size == 0 || !filter || !data)
     {
         log_message(LOG_ERROR, "Invalid input for sensor parsing");
         return 0;
     }
 
-    data->sensor_count = 0;
-
+    const uint64_t parse_start = stats_clock_ns();
     json_error_t json_error;
-    json_t *root = json_loads(json, 0, &json_error);
+    json_t *root = json_loadb(json, json_size, 0, &json_error);
     if (!root)
     {
         log_message(LOG_ERROR, "JSON parse error: %s", json_error.text);
@@ -294,12 +552,19 @@ static int parse_all_sensor_data(const char *json, monitor_sensor_data_t *data)
     }
 
     size_t device_count = json_array_size(devices);
+    size_t updated_devices = 0;
+    char poll_cursor[sizeof(sensor_state.cursor)] = {0};
     for (size_t i = 0; i < device_count; i++)
     {
         const json_t *device = json_array_get(devices, i);
         if (!device)
             continue;
 
+        /* Devices without a status newer than the cursor keep their values */
+        const json_t *last_status = get_latest_status(device);
+        if (!last_status)
+            continue;
+
         const char *device_type = extract_device_type_from_json(device);
         if (!device_type)
             continue;
@@ -311,48 +576,157 @@ static int parse_all_sensor_data(const char *json, monitor_sensor_data_t *data)
 
         const char *device_uid = json_string_value(uid_val);
 
-        /* Collect all temps and channels from this device */
-        collect_device_temps(device, device_uid, device_type, data);
-        collect_device_channels(device, device_uid, device_type, data);
+        /* The cursor advances for all devices, even unused ones */
+        track_status_timestamp(last_status, poll_cursor, sizeof(poll_cursor));
+        updated_devices++;
+
+        if (!filter_wants_device(filter, device_uid, device_type))
+            continue;
+
+        /* Hot-plugged device: fetch its name once the poll is parsed */
+        if (!is_device_uid_cached(device_uid))
+            sensor_state.unknown_devices = 1;
+
+        const sensor_device_t *sensor_device =
+            intern_sensor_device(device_uid, device_type);
+        if (!sensor_device)
+            continue;
+
+        /* Collect slot temps and all channels from this device */
+        collect_device_temps(last_status, sensor_device, filter, data);
+        collect_device_channels(last_status, sensor_device, data);
     }
 
     json_decref(root);
-    log_message(LOG_INFO, "Parsed %d sensors from %zu devices",
-                data->sensor_count, device_count);
+
+    if (strcmp(poll_cursor, sensor_state.cursor) > 0)
+        cc_safe_strcpy(sensor_state.cursor, sizeof(sensor_state.cursor),
+                       poll_cursor);
+
+    /* Resync from the epoch if the cursor stops yielding statuses, e.g. after
+     * a daemon restart or a clock change */
+    if (updated_devices == 0 && device_count > 0 &&
+        ++sensor_state.empty_polls >= STATUS_RESYNC_EMPTY_POLLS)
+    {
+        log_message(LOG_INFO, "No new status since %s, resyncing",
+                    sensor_state.cursor);
+        sensor_state.cursor[0] = '\0';
+        sensor_state.empty_polls = 0;
+    }
+    else if (updated_devices > 0)
+    {
+        sensor_state.empty_polls = 0;
+    }
+
+    record_stage_time(STAT_SENSOR_PARSE, parse_start);
+    log_message(LOG_INFO, "Updated %zu of %zu devices (%d sensors)",
+                updated_devices, device_count, data->sensor_count);
+    return 1;
+}
+
+/**
+ * @brief Name sensors of devices that appeared after startup.
+ * @details Runs after a parsed poll or event reported a UID the device cache
+ * has not seen; entries created before the refresh move to a device record
+ * with the name.
+ */
+static void refresh_unknown_devices(monitor_sensor_data_t *data)
+{
+    if (!sensor_state.unknown_devices)
+        return;
+    sensor_state.unknown_devices = 0;
+
+    if (refresh_device_name_cache() <= 0)
+        return;
+
+    for (int i = 0; i < data->sensor_count; i++)
+    {
+        sensor_entry_t *entry = &data->sensors[i];
+        if (entry->device->name[0] != '\0')
+            continue;
+
+        const sensor_device_t *device =
+            intern_sensor_device(entry->device->uid, entry->device->type);
+        if (device)
+            entry->device = device;
+    }
+}
+
+/**
+ * @brief Apply a /status document to the persistent sensor table.
+ * @details Shared by polling, the event stream and offline replay. Builds the
+ * slot filter on first use and re-resolves slots only when new sensors
+ * appeared.
+ */
+static int apply_status_document(const Config *configs, int config_count,
+                                 const char *json, size_t json_size)
+{
+    if (!sensor_state.filter.valid)
+        build_slot_filter(configs, config_count, &sensor_state.filter);
+
+    const int previous_count = sensor_state.data.sensor_count;
+    if (!parse_all_sensor_data(json, json_size, &sensor_state.filter,
+                               &sensor_state.data))
+        return 0;
+
+    refresh_unknown_devices(&sensor_state.data);
+
+    if (sensor_state.data.slot_count == 0 ||
+        sensor_state.data.sensor_count != previous_count)
+        resolve_slot_indices(configs, config_count, &sensor_state.data);
+    return 1;
+}
+
+/**
+ * @brief Replay a recorded /status document without a request.
+ */
+int parse_sensor_status(const Config *configs, int config_count,
+                        const char *json, size_t json_size,
+                        monitor_sensor_data_t *data)
+{
+    if (!configs || config_count <= 0 || !data)
+        return 0;
+
+    if (!apply_status_document(configs, config_count, json, json_size))
+        return 0;
+
+    sensor_state.data.poll_start_ns = 0;
+    copy_sensor_data(data, &sensor_state.data);
     return 1;
 }
 
 /**
  * @brief Configure CURL for status API request.
- * @details Helper function to set up CURL options for temperature data request.
+ * @details Sets the per-request options; URL and headers are set once when
+ * the handle is created.
  */
-static void configure_status_request(CURL *curl, const char *url,
+static void configure_status_request(CURL *curl,
                                      struct http_response *response)
 {
-    // Basic CURL configuration
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION,
-                     (curl_write_callback)write_callback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "CoolerDash/1.0");
-    curl_easy_setopt(curl, CURLOPT_POST, 1L);
 
-    // POST data for status request
-    const char *post_data =
-        "{\"all\":false,\"since\":\"1970-01-01T00:00:00.000Z\"}";
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, post_data);
+    // POST data for status request: only statuses newer than the cursor.
+    // The body must stay valid until the transfer completes.
+    snprintf(sensor_state.post_body, sizeof(sensor_state.post_body),
+             "{\"all\":false,\"since\":\"%s\"}",
+             sensor_state.cursor[0] != '\0' ? sensor_state.cursor
+                                            : "1970-01-01T00:00:00.000Z");
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, sensor_state.post_body);
 }
 
 /**
  * @brief Get all sensor data from CoolerControl /status API.
- * @details Polls the API and collects all sensors into the data structure.
+ * @details Polls the API incrementally and copies the updated persistent
+ * sensor table into the data structure.
  */
-static int get_sensor_data_from_api(const Config *config,
+static int get_sensor_data_from_api(const Config *configs, int config_count,
                                     monitor_sensor_data_t *data)
 {
-    if (!config || !data)
+    if (!configs || config_count <= 0 || !data)
         return 0;
 
+    const Config *config = &configs[0];
+
     data->sensor_count = 0;
 
     if (config->daemon_address[0] == '\0')
@@ -365,34 +739,21 @@ static int get_sensor_data_from_api(const Config *config,
     if (!curl)
         return 0;
 
-    curl_easy_reset(curl);
-
-    char url[256];
-    int url_len = snprintf(url, sizeof(url), "%s/status", config->daemon_address);
-    if (url_len < 0 || url_len >= (int)sizeof(url))
-        return 0;
-
-    struct http_response response = {0};
-    if (!cc_init_response_buffer(&response, 8192))
+    struct http_response *response = &sensor_response;
+    if (!cc_reuse_response_buffer(response, 8192))
     {
         log_message(LOG_ERROR, "Failed to allocate response buffer");
         return 0;
     }
 
-    configure_status_request(curl, url, &response);
-
-    struct curl_slist *headers = NULL;
-    headers = curl_slist_append(headers, "accept: application/json");
-    headers = curl_slist_append(headers, "content-type: application/json");
-
-    const char *bearer = get_session_access_token();
-    if (bearer && bearer[0] != '\0')
-        headers = curl_slist_append(headers, bearer);
-
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    configure_status_request(curl, response);
 
     int result = 0;
-    CURLcode curl_result = curl_easy_perform(curl);
+    const uint64_t poll_start = stats_clock_ns();
+    CURLcode curl_result =
+        cc_perform_transfer(curl, cc_request_deadline_ms(config));
+    record_stage_time(STAT_SENSOR_HTTP, poll_start);
+    cc_record_transfer(curl);
     if (curl_result == CURLE_OK)
     {
         long response_code = 0;
@@ -400,7 +761,13 @@ static int get_sensor_data_from_api(const Config *config,
 
         if (response_code == 200)
         {
-            result = parse_all_sensor_data(response.data, data);
+            result = apply_status_document(configs, config_count,
+                                           response->data, response->size);
+            if (result)
+            {
+                sensor_state.data.poll_start_ns = poll_start;
+                copy_sensor_data(data, &sensor_state.data);
+            }
         }
         else
         {
@@ -408,18 +775,280 @@ static int get_sensor_data_from_api(const Config *config,
                         response_code);
         }
     }
-    else
+    else if (curl_result == CURLE_OPERATION_TIMEDOUT)
+    {
+        log_message(LOG_WARNING, "Sensor request exceeded its %ld ms deadline",
+                    cc_request_deadline_ms(config));
+    }
+    else if (curl_result != CURLE_ABORTED_BY_CALLBACK)
     {
         log_message(LOG_ERROR, "CURL error: %s", curl_easy_strerror(curl_result));
     }
 
-    cc_cleanup_response_buffer(&response);
-    if (headers)
-        curl_slist_free_all(headers);
-
     return result;
 }
 
+// ============================================================================
+// Status Stream (SSE)
+// ============================================================================
+
+/** @brief Displayed values of all resolved slots, compared between events. */
+typedef float slot_snapshot_t[MAX_SLOT_INDEX][1 + SENSOR_CATEGORY_COUNT];
+
+/**
+ * @brief Parser and publish state of one /sse/status connection.
+ * @details line collects a partial line across writes, event the data lines
+ * of the current event.
+ */
+typedef struct
+{
+    const Config *configs;
+    int config_count;
+    const sensor_stream_handler_t *handler;
+    http_response line;
+    http_response event;
+    slot_snapshot_t published;
+    int has_published;
+    struct timespec last_publish;
+    int stopped;
+} sensor_stream_t;
+
+/** @brief Value as displayed: one decimal or whole numbers. */
+static float displayed_value(const monitor_sensor_data_t *data, short index)
+{
+    if (index < 0 || index >= data->sensor_count)
+        return SLOT_VALUE_MISSING;
+
+    const sensor_entry_t *entry = &data->sensors[index];
+    return entry->use_decimal ? roundf(entry->value * 10.0f) / 10.0f
+                              : roundf(entry->value);
+}
+
+/** @brief Capture the displayed values of every resolved slot. */
+static void take_slot_snapshot(const monitor_sensor_data_t *data,
+                               slot_snapshot_t snapshot)
+{
+    for (int i = 0; i < MAX_SLOT_INDEX; i++)
+    {
+        const sensor_slot_index_t *slot = &data->slots[i];
+        const int valid = i < data->slot_count;
+        snapshot[i][0] = valid ? displayed_value(data, slot->sensor_index)
+                               : SLOT_VALUE_MISSING;
+        for (int c = 0; c < SENSOR_CATEGORY_COUNT; c++)
+            snapshot[i][1 + c] = valid ? displayed_value(data, slot->channel_index[c])
+                                       : SLOT_VALUE_MISSING;
+    }
+}
+
+/** @brief Seconds elapsed since a monotonic timestamp. */
+static double seconds_since(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) +
+           (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Hand the sensor table to the subscriber if it is due.
+ * @details Due when a displayed value changed since the last delivery, or
+ * when the refresh interval elapsed without one.
+ */
+static void publish_stream_data(sensor_stream_t *stream, int values_updated)
+{
+    slot_snapshot_t snapshot;
+    int due = !stream->has_published ||
+              seconds_since(&stream->last_publish) >=
+                  (double)stream->configs[0].display_refresh_interval;
+
+    if (!due && values_updated)
+    {
+        take_slot_snapshot(&sensor_state.data, snapshot);
+        due = memcmp(snapshot, stream->published, sizeof(snapshot)) != 0;
+    }
+    if (!due)
+        return;
+
+    take_slot_snapshot(&sensor_state.data, stream->published);
+    stream->has_published = 1;
+    clock_gettime(CLOCK_MONOTONIC, &stream->last_publish);
+
+    if (!stream->handler->publish(&sensor_state.data, stream->handler->context))
+        stream->stopped = 1;
+}
+
+/** @brief Apply the data of a complete event to the sensor table. */
+static void dispatch_stream_event(sensor_stream_t *stream)
+{
+    if (stream->event.size == 0)
+        return;
+
+    const uint64_t event_start = stats_clock_ns();
+    if (apply_status_document(stream->configs, stream->config_count,
+                              stream->event.data, stream->event.size))
+    {
+        sensor_state.data.poll_start_ns = event_start;
+        publish_stream_data(stream, 1);
+    }
+
+    stream->event.size = 0;
+    stream->event.data[0] = '\0';
+}
+
+/**
+ * @brief Handle one event stream line (without line terminator).
+ * @details An empty line ends the event. Only "data" fields are used;
+ * comments (keep-alives) and other fields are ignored.
+ */
+static void handle_stream_line(sensor_stream_t *stream, const char *line,
+                               size_t length)
+{
+    if (length == 0)
+    {
+        dispatch_stream_event(stream);
+        return;
+    }
+    if (length < 5 || strncmp(line, "data:", 5) != 0)
+        return;
+
+    const char *value = line + 5;
+    size_t value_length = length - 5;
+    if (value_length > 0 && value[0] == ' ')
+    {
+        value++;
+        value_length--;
+    }
+
+    if (stream->event.size > 0)
+        write_callback("\n", 1, 1, &stream->event);
+    write_callback(value, 1, value_length, &stream->event);
+}
+
+/** @brief libcurl write callback: split the stream into lines. */
+static size_t stream_write_callback(const char *contents, size_t size,
+                                    size_t nmemb, void *userdata)
+{
+    sensor_stream_t *stream = userdata;
+    const size_t total = size * nmemb;
+    size_t offset = 0;
+
+    while (offset < total && !stream->stopped)
+    {
+        const char *start = contents + offset;
+        const char *newline = memchr(start, '\n', total - offset);
+        const size_t chunk = newline ? (size_t)(newline - start) : total - offset;
+
+        if (chunk > 0 && write_callback(start, 1, chunk, &stream->line) != chunk)
+            return 0;
+        offset += chunk;
+        if (!newline)
+            break;
+        offset++;
+
+        size_t length = stream->line.size;
+        if (length > 0 && stream->line.data[length - 1] == '\r')
+            length--;
+        handle_stream_line(stream, stream->line.data, length);
+        stream->line.size = 0;
+        stream->line.data[0] = '\0';
+    }
+
+    return stream->stopped ? 0 : total;
+}
+
+/**
+ * @brief libcurl progress callback: stops the stream and keeps deliveries
+ * on schedule while no event arrives.
+ */
+static int stream_progress_callback(void *userdata, curl_off_t dltotal,
+                                    curl_off_t dlnow, curl_off_t ultotal,
+                                    curl_off_t ulnow)
+{
+    (void)dltotal;
+    (void)dlnow;
+    (void)ultotal;
+    (void)ulnow;
+    sensor_stream_t *stream = userdata;
+
+    if (!stream->stopped && stream->has_published)
+        publish_stream_data(stream, 0);
+    if (!stream->stopped &&
+        stream->handler->should_stop(stream->handler->context))
+        stream->stopped = 1;
+
+    return stream->stopped;
+}
+
+/**
+ * @brief Subscribe to /sse/status and apply status events as they arrive.
+ */
+sensor_stream_result_t stream_sensor_monitor_data(
+    const Config *configs, int config_count,
+    const sensor_stream_handler_t *handler)
+{
+    if (!configs || config_count <= 0 || !handler || !handler->publish ||
+        !handler->should_stop)
+        return SENSOR_STREAM_ENDED;
+
+    const char *url = get_session_url(CC_ENDPOINT_SSE_STATUS);
+    struct curl_slist *headers = get_session_headers(CC_HEADERS_EVENT_STREAM);
+    if (url[0] == '\0' || !headers)
+        return SENSOR_STREAM_ENDED;
+
+    sensor_stream_t stream = {.configs = configs,
+                              .config_count = config_count,
+                              .handler = handler};
+    if (!cc_init_response_buffer(&stream.line, 1024) ||
+        !cc_init_response_buffer(&stream.event, 16384))
+    {
+        cc_cleanup_response_buffer(&stream.line);
+        log_message(LOG_ERROR, "Failed to allocate status stream buffers");
+        return SENSOR_STREAM_ENDED;
+    }
+
+    CURL *curl = cc_create_easy_handle();
+    if (!curl)
+    {
+        cc_cleanup_response_buffer(&stream.line);
+        cc_cleanup_response_buffer(&stream.event);
+        return SENSOR_STREAM_ENDED;
+    }
+
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, stream_write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &stream);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, stream_progress_callback);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &stream);
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, STATUS_STREAM_STALL_SEC);
+
+    log_message(LOG_INFO, "Subscribing to status stream: %s", url);
+    const CURLcode res = cc_perform_transfer(curl, 0);
+    cc_record_transfer(curl);
+
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    cc_release_easy_handle(curl);
+    cc_cleanup_response_buffer(&stream.line);
+    cc_cleanup_response_buffer(&stream.event);
+
+    if (stream.stopped)
+        return SENSOR_STREAM_STOPPED;
+    if (http_code == 404 || http_code == 405)
+    {
+        log_message(LOG_WARNING,
+                    "CoolerControl has no status stream (HTTP %ld), polling /status",
+                    http_code);
+        return SENSOR_STREAM_UNSUPPORTED;
+    }
+
+    log_message(LOG_WARNING, "Status stream ended (CURL %d: %s, HTTP %ld)",
+                (int)res, curl_easy_strerror(res), http_code);
+    return SENSOR_STREAM_ENDED;
+}
+
 // ============================================================================
 // Slot Resolution Functions
 // ============================================================================
@@ -463,7 +1092,7 @@ static const sensor_entry_t *find_preferred_legacy_duty_sensor(
     {
         const sensor_entry_t *sensor = &data->sensors[i];
         if (sensor->category != SENSOR_CATEGORY_DUTY ||
-            strcmp(sensor->device_type, target_type) != 0)
+            strcmp(sensor->device->type, target_type) != 0)
             continue;
 
         if (!first_matching)
@@ -509,7 +1138,7 @@ static const sensor_entry_t *resolve_legacy_slot(
     for (int i = 0; i < data->sensor_count; i++)
     {
         if (data->sensors[i].category == category &&
-            strcmp(data->sensors[i].device_type, target_type) == 0)
+            strcmp(data->sensors[i].device->type, target_type) == 0)
         {
             return &data->sensors[i];
         }
@@ -519,12 +1148,12 @@ static const sensor_entry_t *resolve_legacy_slot(
 }
 
 /**
- * @brief Find sensor entry matching a slot value.
+ * @brief Scan for the sensor entry matching a slot value.
  * @details Handles both legacy ("cpu","gpu","liquid") and dynamic
  * ("uid:sensor_name") slot resolution. Always matches temperature sensors.
  */
-const sensor_entry_t *find_sensor_for_slot(const monitor_sensor_data_t *data,
-                                           const char *slot_value)
+static const sensor_entry_t *scan_sensor_for_slot(
+    const monitor_sensor_data_t *data, const char *slot_value)
 {
     if (!data || !slot_value || strcmp(slot_value, "none") == 0)
         return NULL;
@@ -543,8 +1172,9 @@ const sensor_entry_t *find_sensor_for_slot(const monitor_sensor_data_t *data,
 
     for (int i = 0; i < data->sensor_count; i++)
     {
-        if (strlen(data->sensors[i].device_uid) == uid_len &&
-            strncmp(data->sensors[i].device_uid, slot_value, uid_len) == 0 &&
+        const char *device_uid = data->sensors[i].device->uid;
+        if (strlen(device_uid) == uid_len &&
+            strncmp(device_uid, slot_value, uid_len) == 0 &&
             strcmp(data->sensors[i].name, sensor_name) == 0)
         {
             return &data->sensors[i];
@@ -555,11 +1185,11 @@ const sensor_entry_t *find_sensor_for_slot(const monitor_sensor_data_t *data,
 }
 
 /**
- * @brief Find channel sensor matching a slot value and category.
- * @details Like find_sensor_for_slot() but matches a specific sensor category
+ * @brief Scan for a channel sensor matching a slot value and category.
+ * @details Like scan_sensor_for_slot() but matches a specific sensor category
  * instead of always matching temperature sensors.
  */
-const sensor_entry_t *find_channel_sensor_for_slot(
+static const sensor_entry_t *scan_channel_sensor_for_slot(
     const monitor_sensor_data_t *data, const char *slot_value,
     sensor_category_t category)
 {
@@ -579,9 +1209,10 @@ const sensor_entry_t *find_channel_sensor_for_slot(
 
     for (int i = 0; i < data->sensor_count; i++)
     {
+        const char *device_uid = data->sensors[i].device->uid;
         if (data->sensors[i].category == category &&
-            strlen(data->sensors[i].device_uid) == uid_len &&
-            strncmp(data->sensors[i].device_uid, slot_value, uid_len) == 0)
+            strlen(device_uid) == uid_len &&
+            strncmp(device_uid, slot_value, uid_len) == 0)
         {
             return &data->sensors[i];
         }
@@ -590,6 +1221,118 @@ const sensor_entry_t *find_channel_sensor_for_slot(
     return NULL;
 }
 
+/** @brief Convert a sensor pointer into a slot table index. */
+static short get_sensor_index(const monitor_sensor_data_t *data,
+                              const sensor_entry_t *sensor)
+{
+    return sensor ? (short)(sensor - data->sensors) : -1;
+}
+
+/** @brief Add a slot value to the slot table and resolve its sensors. */
+static void add_slot_index(monitor_sensor_data_t *data, const char *slot_value)
+{
+    if (!slot_value || slot_value[0] == '\0' || data->slot_count >= MAX_SLOT_INDEX)
+        return;
+
+    for (int i = 0; i < data->slot_count; i++)
+    {
+        if (strcmp(data->slots[i].slot_value, slot_value) == 0)
+            return;
+    }
+
+    sensor_slot_index_t *slot = &data->slots[data->slot_count++];
+    slot->slot_value = slot_value;
+    slot->sensor_index =
+        get_sensor_index(data, scan_sensor_for_slot(data, slot_value));
+    for (int c = 0; c < SENSOR_CATEGORY_COUNT; c++)
+    {
+        slot->channel_index[c] = get_sensor_index(
+            data, scan_channel_sensor_for_slot(data, slot_value,
+                                               (sensor_category_t)c));
+    }
+}
+
+/**
+ * @brief Resolve the configured slots against the current sensor table.
+ * @details Entries are updated in place and only appended, so indices stay
+ * valid until the sensor set changes.
+ */
+static void resolve_slot_indices(const Config *configs, int config_count,
+                                 monitor_sensor_data_t *data)
+{
+    data->slot_count = 0;
+    for (int i = 0; i < config_count; i++)
+    {
+        add_slot_index(data, configs[i].sensor_slot_1);
+        add_slot_index(data, configs[i].sensor_slot_2);
+        add_slot_index(data, configs[i].sensor_slot_3);
+    }
+
+    /* Circle mode shows the AIO fan RPM next to the cpu slot */
+    add_slot_index(data, "liquid");
+}
+
+/** @brief Find the pre-resolved slot table entry of a slot value. */
+static const sensor_slot_index_t *find_slot_index(
+    const monitor_sensor_data_t *data, const char *slot_value)
+{
+    for (int i = 0; i < data->slot_count; i++)
+    {
+        const sensor_slot_index_t *slot = &data->slots[i];
+        if (slot->slot_value == slot_value ||
+            strcmp(slot->slot_value, slot_value) == 0)
+            return slot;
+    }
+
+    return NULL;
+}
+
+/** @brief Convert a slot table index into a sensor pointer. */
+static const sensor_entry_t *get_indexed_sensor(
+    const monitor_sensor_data_t *data, short index)
+{
+    return (index >= 0 && index < data->sensor_count) ? &data->sensors[index]
+                                                       : NULL;
+}
+
+/**
+ * @brief Find sensor entry matching a slot value.
+ * @details Uses the pre-resolved slot table, falls back to a scan for slot
+ * values that are not configured.
+ */
+const sensor_entry_t *find_sensor_for_slot(const monitor_sensor_data_t *data,
+                                           const char *slot_value)
+{
+    if (!data || !slot_value)
+        return NULL;
+
+    const sensor_slot_index_t *slot = find_slot_index(data, slot_value);
+    if (slot)
+        return get_indexed_sensor(data, slot->sensor_index);
+
+    return scan_sensor_for_slot(data, slot_value);
+}
+
+/**
+ * @brief Find channel sensor matching a slot value and category.
+ * @details Uses the pre-resolved slot table, falls back to a scan for slot
+ * values that are not configured.
+ */
+const sensor_entry_t *find_channel_sensor_for_slot(
+    const monitor_sensor_data_t *data, const char *slot_value,
+    sensor_category_t category)
+{
+    if (!data || !slot_value || category < 0 ||
+        category >= SENSOR_CATEGORY_COUNT)
+        return NULL;
+
+    const sensor_slot_index_t *slot = find_slot_index(data, slot_value);
+    if (slot)
+        return get_indexed_sensor(data, slot->channel_index[category]);
+
+    return scan_channel_sensor_for_slot(data, slot_value, category);
+}
+
 // ============================================================================
 // Public API
 // ============================================================================
@@ -597,10 +1340,11 @@ const sensor_entry_t *find_channel_sensor_for_slot(
 /**
  * @brief Get all sensor data from CoolerControl API.
  */
-int get_sensor_monitor_data(const Config *config, monitor_sensor_data_t *data)
+int get_sensor_monitor_data(const Config *configs, int config_count,
+                            monitor_sensor_data_t *data)
 {
-    if (!config || !data)
+    if (!configs || config_count <= 0 || !data)
         return 0;
 
-    return get_sensor_data_from_api(config, data);
+    return get_sensor_data_from_api(configs, config_count, data);
 }
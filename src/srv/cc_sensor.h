@@ -19,21 +19,21 @@
 
 // cppcheck-suppress-begin missingIncludeSystem
 #include <stddef.h>
+#include <stdint.h>
 // cppcheck-suppress-end missingIncludeSystem
 
-// Forward declaration
-struct Config;
+// Include project headers
+#include "../device/config.h"
+#include "cc_conf.h"
 
 // ============================================================================
 // Sensor Data Model Constants
 // ============================================================================
 
-#define MAX_SENSORS 64
+#define MAX_SENSORS 256
 #define SENSOR_NAME_LEN 48
-#define SENSOR_UID_LEN 96
-#define SENSOR_DEVICE_NAME_LEN 64
-#define SENSOR_DEVICE_TYPE_LEN 16
-#define SENSOR_UNIT_LEN 8
+#define SENSOR_UID_LEN SENSOR_DEVICE_UID_LEN
+#define MAX_SLOT_INDEX (3 * MAX_LCD_DISPLAYS + 1)
 
 // ============================================================================
 // Sensor Category Enum
@@ -49,7 +49,8 @@ typedef enum
     SENSOR_CATEGORY_RPM,      /**< Fan/Pump speed in RPM */
     SENSOR_CATEGORY_DUTY,     /**< Duty cycle in % */
     SENSOR_CATEGORY_WATTS,    /**< Power consumption in W */
-    SENSOR_CATEGORY_FREQ      /**< Frequency in MHz */
+    SENSOR_CATEGORY_FREQ,     /**< Frequency in MHz */
+    SENSOR_CATEGORY_COUNT     /**< Number of categories */
 } sensor_category_t;
 
 // ============================================================================
@@ -59,34 +60,59 @@ typedef enum
 /**
  * @brief Single sensor data entry from CoolerControl API.
  * @details Represents one sensor value with its metadata. Names match
- * CoolerControl's display names for maximum UI synchronicity.
+ * CoolerControl's display names for maximum UI synchronicity. The strings
+ * are interned: the name lives in the persistent sensor table, the device in
+ * the device cache, so a poll only rewrites the value and copying an entry
+ * copies no strings.
  */
 typedef struct
 {
-    char name[SENSOR_NAME_LEN];               /**< CC sensor name (e.g. "temp1", "Liquid Temperature") */
-    char device_uid[SENSOR_UID_LEN];          /**< CC device UID */
-    char device_name[SENSOR_DEVICE_NAME_LEN]; /**< CC device name (e.g. "NZXT Kraken Z73") */
-    char device_type[SENSOR_DEVICE_TYPE_LEN]; /**< CC device type ("CPU","GPU","Liquidctl","Hwmon","CustomSensors") */
-    sensor_category_t category;               /**< Sensor value category */
-    float value;                              /**< Current sensor value */
-    char unit[SENSOR_UNIT_LEN];               /**< Display unit ("°C","RPM","%","W","MHz") */
-    int use_decimal;                          /**< 1=show decimal (e.g. 31.5), 0=integer (e.g. 1200) */
+    const char *name;              /**< CC sensor name (e.g. "temp1", "Liquid Temperature") */
+    const sensor_device_t *device; /**< Interned device: UID, name, type */
+    const char *unit;              /**< Display unit ("°C","RPM","%","W","MHz") */
+    sensor_category_t category;    /**< Sensor value category */
+    float value;                   /**< Current sensor value */
+    int use_decimal;               /**< 1=show decimal (e.g. 31.5), 0=integer (e.g. 1200) */
 } sensor_entry_t;
 
 // ============================================================================
 // Monitor Sensor Data (runtime collection)
 // ============================================================================
 
+/**
+ * @brief Pre-resolved sensor indices for one slot value.
+ * @details Filled after each poll that changed the sensor set. Indices point
+ * into sensors[], -1 means the slot does not resolve.
+ */
+typedef struct
+{
+    const char *slot_value;                  /**< Slot value (points into Config) */
+    short sensor_index;                      /**< find_sensor_for_slot() result */
+    short channel_index[SENSOR_CATEGORY_COUNT]; /**< find_channel_sensor_for_slot() results */
+} sensor_slot_index_t;
+
 /**
  * @brief Collection of all sensor values from one API poll.
  * @details Contains all discovered sensors across all CoolerControl devices.
+ * Copy it with copy_sensor_data(), which skips the unused entries.
  */
 typedef struct
 {
-    sensor_entry_t sensors[MAX_SENSORS]; /**< Array of all discovered sensors */
-    int sensor_count;                    /**< Number of valid entries in sensors[] */
+    int sensor_count;                           /**< Number of valid entries in sensors[] */
+    int slot_count;                             /**< Number of valid entries in slots[] */
+    uint64_t poll_start_ns;                     /**< Monotonic start of the poll or event (stats) */
+    sensor_slot_index_t slots[MAX_SLOT_INDEX];  /**< Resolved slot indices */
+    sensor_entry_t sensors[MAX_SENSORS];        /**< Array of all discovered sensors */
 } monitor_sensor_data_t;
 
+/**
+ * @brief Copy sensor data up to the last valid entry.
+ * @details The entries' strings stay shared with the source; they remain
+ * valid until reset_sensor_state().
+ */
+void copy_sensor_data(monitor_sensor_data_t *dest,
+                      const monitor_sensor_data_t *src);
+
 // ============================================================================
 // Sensor Slot Resolution Functions
 // ============================================================================
@@ -95,6 +121,7 @@ typedef struct
  * @brief Find sensor entry matching a slot value.
  * @details Resolves legacy ("cpu","gpu","liquid") and dynamic ("uid:name")
  * slot values to the corresponding sensor_entry_t in the data array.
+ * Configured slots are looked up in the pre-resolved slot table.
  * @param data Current sensor data collection
  * @param slot_value Slot configuration value
  * @return Pointer to matching sensor entry, or NULL if not found
@@ -129,18 +156,86 @@ const sensor_entry_t *find_channel_sensor_for_slot(
 
 /**
  * @brief Get all sensor data from CoolerControl API.
- * @details Polls /status endpoint and collects all sensors (temps + channels)
- * from all device types into the monitor_sensor_data_t structure.
- * @param config Configuration with daemon address
+ * @details Polls /status endpoint once and collects the sensors (temps +
+ * channels) the slots of any display can resolve to into the
+ * monitor_sensor_data_t structure, so all LCDs share one fetch.
+ * @param configs Display configurations, the first provides the daemon address
+ * @param config_count Number of display configurations
  * @param data Output sensor data structure
  * @return 1 on success, 0 on failure
  */
-int get_sensor_monitor_data(const struct Config *config,
+int get_sensor_monitor_data(const struct Config *configs, int config_count,
                             monitor_sensor_data_t *data);
 
+/**
+ * @brief Apply a recorded /status document without a request.
+ * @details Updates the same persistent sensor table as
+ * get_sensor_monitor_data(); used by the render benchmark to replay fixtures.
+ * @param configs Display configurations whose slots select the sensors
+ * @param config_count Number of display configurations
+ * @param json /status response body
+ * @param json_size Length of json in bytes
+ * @param data Output sensor data structure
+ * @return 1 on success, 0 on failure
+ */
+int parse_sensor_status(const struct Config *configs, int config_count,
+                        const char *json, size_t json_size,
+                        monitor_sensor_data_t *data);
+
+/** @brief How a status stream ended. */
+typedef enum
+{
+    SENSOR_STREAM_ENDED,      /**< Connection lost or failed; reconnect later */
+    SENSOR_STREAM_STOPPED,    /**< Stopped by the handler */
+    SENSOR_STREAM_UNSUPPORTED /**< coolercontrold has no /sse/status endpoint */
+} sensor_stream_result_t;
+
+/** @brief Callbacks of a status stream subscriber. */
+typedef struct
+{
+    /** @brief Deliver updated data; return 0 to stop the stream. */
+    int (*publish)(const monitor_sensor_data_t *data, void *context);
+    /** @brief Polled at least once per second; return 1 to stop the stream. */
+    int (*should_stop)(void *context);
+    void *context;
+} sensor_stream_handler_t;
+
+/**
+ * @brief Subscribe to /sse/status and apply status events as they arrive.
+ * @details Keeps one long-lived connection open. Each event updates the same
+ * persistent sensor table as get_sensor_monitor_data(). The handler gets the
+ * data when a displayed slot value changed, and at least once per refresh
+ * interval of the first display (circle rotation, forced refresh). Blocks
+ * until the stream ends or the handler stops it.
+ * @param configs Display configurations, the first provides the interval
+ * @param config_count Number of display configurations
+ * @param handler Subscriber callbacks
+ * @return How the stream ended
+ */
+sensor_stream_result_t stream_sensor_monitor_data(
+    const struct Config *configs, int config_count,
+    const sensor_stream_handler_t *handler);
+
+/**
+ * @brief Drop cached sensor values and restart polling from the epoch.
+ * @details Called on config reload (SIGHUP) so removed sensors disappear and
+ * the next poll fetches a full status.
+ */
+void reset_sensor_state(void);
+
+/**
+ * @brief Restart incremental polling from the epoch, keeping cached values.
+ * @details Called from the fetch stage after coolercontrold was unreachable:
+ * a restarted daemon's timestamps may lie before the old cursor. Unlike
+ * reset_sensor_state() it leaves the entries alone, so it is safe while the
+ * render stage holds published sensor data.
+ */
+void restart_status_polling(void);
+
 /**
  * @brief Cleanup cached sensor CURL handle.
- * @details Called during daemon shutdown to free resources.
+ * @details Called on shutdown and SIGHUP reload, before the session (and its
+ * shared connection pool) is reset.
  */
 void cleanup_sensor_curl_handle(void);
 